@@ -0,0 +1,313 @@
+"""
+Writes bloom_filter.parquet: a file with split block Bloom filters that is not written by DuckDB.
+
+The file is written directly from the Parquet specification (thrift compact protocol, PLAIN encoded data pages,
+XXH64 hashed split block Bloom filters) without any Parquet library. Like parquet-mr, the Bloom filters of all row
+groups are written after the last row group and the column chunks only set bloom_filter_offset, not
+bloom_filter_length. No statistics are written, so only the Bloom filters can be used to skip row groups.
+
+Columns (two row groups of 1000 rows, row r = 0..1999):
+    i32   INT32                          2 * r
+    i64   INT64                          2 * r + 10000000000
+    s     BYTE_ARRAY (STRING)            'key_' || (2 * r)
+    u     FIXED_LEN_BYTE_ARRAY(16) UUID  '{p}-0000-4000-8000-{2 * r:012x}', p = '00000000' or 'f0000000' (row group 1)
+    stale INT32                          r, but its Bloom filters contain r + 1000000 instead of r. A reader that
+                                         probes the filters therefore does not find the rows of this column.
+
+Usage: python3 bloom-filter-generate-parquet.py [output_path]
+"""
+
+import struct
+import sys
+import uuid
+
+ROW_GROUPS = 2
+ROWS_PER_GROUP = 1000
+BLOOM_FILTER_BYTES = 8192
+
+# parquet enums
+INT32, INT64, BYTE_ARRAY, FIXED_LEN_BYTE_ARRAY = 1, 2, 6, 7
+REQUIRED = 0
+UTF8 = 0
+PLAIN, RLE = 0, 3
+UNCOMPRESSED = 0
+DATA_PAGE = 0
+
+# thrift compact protocol types
+CT_I32, CT_I64, CT_BINARY, CT_LIST, CT_STRUCT = 5, 6, 8, 9, 12
+
+
+# ------------------------------------------------------------------------------------------------------------------
+# XXH64
+# ------------------------------------------------------------------------------------------------------------------
+P1 = 11400714785074694791
+P2 = 14029467366897019727
+P3 = 1609587929392839161
+P4 = 9650029242287828579
+P5 = 2870177450012600261
+M64 = (1 << 64) - 1
+
+
+def rotl(x, r):
+    return ((x << r) | (x >> (64 - r))) & M64
+
+
+def xxh64_round(acc, value):
+    acc = (acc + value * P2) & M64
+    return (rotl(acc, 31) * P1) & M64
+
+
+def xxh64_merge(acc, value):
+    acc ^= xxh64_round(0, value)
+    return (acc * P1 + P4) & M64
+
+
+def xxh64(data, seed=0):
+    length = len(data)
+    offset = 0
+    if length >= 32:
+        v1 = (seed + P1 + P2) & M64
+        v2 = (seed + P2) & M64
+        v3 = seed
+        v4 = (seed - P1) & M64
+        while offset + 32 <= length:
+            lanes = struct.unpack_from('<4Q', data, offset)
+            v1 = xxh64_round(v1, lanes[0])
+            v2 = xxh64_round(v2, lanes[1])
+            v3 = xxh64_round(v3, lanes[2])
+            v4 = xxh64_round(v4, lanes[3])
+            offset += 32
+        acc = (rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18)) & M64
+        for v in (v1, v2, v3, v4):
+            acc = xxh64_merge(acc, v)
+    else:
+        acc = (seed + P5) & M64
+    acc = (acc + length) & M64
+    while offset + 8 <= length:
+        (lane,) = struct.unpack_from('<Q', data, offset)
+        acc ^= xxh64_round(0, lane)
+        acc = (rotl(acc, 27) * P1 + P4) & M64
+        offset += 8
+    if offset + 4 <= length:
+        (lane,) = struct.unpack_from('<I', data, offset)
+        acc ^= (lane * P1) & M64
+        acc = (rotl(acc, 23) * P2 + P3) & M64
+        offset += 4
+    while offset < length:
+        acc ^= (data[offset] * P5) & M64
+        acc = (rotl(acc, 11) * P1) & M64
+        offset += 1
+    acc ^= acc >> 33
+    acc = (acc * P2) & M64
+    acc ^= acc >> 29
+    acc = (acc * P3) & M64
+    acc ^= acc >> 32
+    return acc
+
+
+assert xxh64(b'') == 0xEF46DB3751D8E999
+assert xxh64(b'a') == 0xD24EC4F1A98C6E5B
+
+
+# ------------------------------------------------------------------------------------------------------------------
+# Split block Bloom filter
+# ------------------------------------------------------------------------------------------------------------------
+SALT = [0x47B6137B, 0x44974D91, 0x8824AD5B, 0xA2B7289D, 0x705495C7, 0x2DF1424B, 0x9EFC4947, 0x5C6BFB31]
+
+
+class BloomFilter:
+    def __init__(self, num_bytes):
+        self.num_blocks = num_bytes // 32
+        self.words = [0] * (self.num_blocks * 8)
+
+    def insert(self, value_bytes):
+        h = xxh64(value_bytes)
+        block = ((h >> 32) * self.num_blocks) >> 32
+        key = h & 0xFFFFFFFF
+        for i in range(8):
+            self.words[block * 8 + i] |= 1 << (((key * SALT[i]) & 0xFFFFFFFF) >> 27)
+
+    def bitset(self):
+        return struct.pack('<%dI' % len(self.words), *self.words)
+
+
+# ------------------------------------------------------------------------------------------------------------------
+# Thrift compact protocol
+# ------------------------------------------------------------------------------------------------------------------
+def varint(n):
+    out = bytearray()
+    while True:
+        if n < 0x80:
+            out.append(n)
+            return bytes(out)
+        out.append((n & 0x7F) | 0x80)
+        n >>= 7
+
+
+def zigzag(n):
+    return (n << 1) ^ (n >> 63)
+
+
+class Struct:
+    """A thrift struct: a list of (field id, compact type, value) with increasing field ids"""
+
+    def __init__(self, *fields):
+        self.fields = [f for f in fields if f[2] is not None]
+
+
+def encode_value(ctype, value):
+    if ctype in (CT_I32, CT_I64):
+        return varint(zigzag(value))
+    if ctype == CT_BINARY:
+        data = value.encode() if isinstance(value, str) else value
+        return varint(len(data)) + data
+    if ctype == CT_STRUCT:
+        return encode_struct(value)
+    if ctype == CT_LIST:
+        elem_type, elems = value
+        header = bytes([(len(elems) << 4) | elem_type]) if len(elems) < 15 else bytes([0xF0 | elem_type]) + varint(
+            len(elems)
+        )
+        return header + b''.join(encode_value(elem_type, e) for e in elems)
+    raise ValueError(ctype)
+
+
+def encode_struct(s):
+    out = bytearray()
+    last_id = 0
+    for field_id, ctype, value in s.fields:
+        delta = field_id - last_id
+        if 0 < delta <= 15:
+            out.append((delta << 4) | ctype)
+        else:
+            out.append(ctype)
+            out += varint(zigzag(field_id))
+        out += encode_value(ctype, value)
+        last_id = field_id
+    out.append(0)
+    return bytes(out)
+
+
+EMPTY = Struct()
+
+
+# ------------------------------------------------------------------------------------------------------------------
+# File
+# ------------------------------------------------------------------------------------------------------------------
+def uuid_bytes(row):
+    prefix = 'f0000000' if row >= ROWS_PER_GROUP else '00000000'
+    return uuid.UUID('%s-0000-4000-8000-%012x' % (prefix, 2 * row)).bytes
+
+
+COLUMNS = [
+    # name, physical type, type length, converted type, logical type, value bytes of row r, value bytes in the filter
+    ('i32', INT32, None, None, None, lambda r: struct.pack('<i', 2 * r), None),
+    ('i64', INT64, None, None, None, lambda r: struct.pack('<q', 2 * r + 10000000000), None),
+    ('s', BYTE_ARRAY, None, UTF8, Struct((1, CT_STRUCT, EMPTY)), lambda r: b'key_%d' % (2 * r), None),
+    ('u', FIXED_LEN_BYTE_ARRAY, 16, None, Struct((14, CT_STRUCT, EMPTY)), uuid_bytes, None),
+    ('stale', INT32, None, None, None, lambda r: struct.pack('<i', r), lambda r: struct.pack('<i', r + 1000000)),
+]
+
+
+def plain_value(column, row):
+    value = column[5](row)
+    if column[1] == BYTE_ARRAY:
+        return struct.pack('<I', len(value)) + value
+    return value
+
+
+def bloom_value(column, row):
+    # the Bloom filter hashes the plain encoding of the value, without the length of byte arrays
+    return (column[6] or column[5])(row)
+
+
+def write_file(path):
+    out = bytearray(b'PAR1')
+    row_groups = []
+    for rg in range(ROW_GROUPS):
+        rows = range(rg * ROWS_PER_GROUP, (rg + 1) * ROWS_PER_GROUP)
+        chunks = []
+        for column in COLUMNS:
+            data = b''.join(plain_value(column, r) for r in rows)
+            page_header = encode_struct(
+                Struct(
+                    (1, CT_I32, DATA_PAGE),
+                    (2, CT_I32, len(data)),
+                    (3, CT_I32, len(data)),
+                    (5, CT_STRUCT, Struct((1, CT_I32, len(rows)), (2, CT_I32, PLAIN), (3, CT_I32, RLE), (4, CT_I32, RLE))),
+                )
+            )
+            offset = len(out)
+            out += page_header + data
+            bloom_filter = BloomFilter(BLOOM_FILTER_BYTES)
+            for r in rows:
+                bloom_filter.insert(bloom_value(column, r))
+            chunks.append((column, offset, len(page_header) + len(data), bloom_filter))
+        row_groups.append(chunks)
+
+    # the Bloom filters of all row groups follow the data
+    bloom_offsets = []
+    for chunks in row_groups:
+        offsets = []
+        for column, _, _, bloom_filter in chunks:
+            offsets.append(len(out))
+            out += encode_struct(
+                Struct(
+                    (1, CT_I32, BLOOM_FILTER_BYTES),
+                    (2, CT_STRUCT, Struct((1, CT_STRUCT, EMPTY))),
+                    (3, CT_STRUCT, Struct((1, CT_STRUCT, EMPTY))),
+                    (4, CT_STRUCT, Struct((1, CT_STRUCT, EMPTY))),
+                )
+            )
+            out += bloom_filter.bitset()
+        bloom_offsets.append(offsets)
+
+    schema = [Struct((4, CT_BINARY, 'schema'), (5, CT_I32, len(COLUMNS)))]
+    for name, physical_type, type_length, converted_type, logical_type, _, _ in COLUMNS:
+        schema.append(
+            Struct(
+                (1, CT_I32, physical_type),
+                (2, CT_I32, type_length),
+                (3, CT_I32, REQUIRED),
+                (4, CT_BINARY, name),
+                (6, CT_I32, converted_type),
+                (10, CT_STRUCT, logical_type),
+            )
+        )
+    row_group_structs = []
+    for chunks, offsets in zip(row_groups, bloom_offsets):
+        columns = []
+        total_size = 0
+        for (column, offset, size, _), bloom_offset in zip(chunks, offsets):
+            total_size += size
+            meta_data = Struct(
+                (1, CT_I32, column[1]),
+                (2, CT_LIST, (CT_I32, [PLAIN, RLE])),
+                (3, CT_LIST, (CT_BINARY, [column[0]])),
+                (4, CT_I32, UNCOMPRESSED),
+                (5, CT_I64, ROWS_PER_GROUP),
+                (6, CT_I64, size),
+                (7, CT_I64, size),
+                (9, CT_I64, offset),
+                (14, CT_I64, bloom_offset),
+            )
+            columns.append(Struct((2, CT_I64, offset), (3, CT_STRUCT, meta_data)))
+        row_group_structs.append(
+            Struct((1, CT_LIST, (CT_STRUCT, columns)), (2, CT_I64, total_size), (3, CT_I64, ROWS_PER_GROUP))
+        )
+    metadata = encode_struct(
+        Struct(
+            (1, CT_I32, 1),
+            (2, CT_LIST, (CT_STRUCT, schema)),
+            (3, CT_I64, ROW_GROUPS * ROWS_PER_GROUP),
+            (4, CT_LIST, (CT_STRUCT, row_group_structs)),
+            (6, CT_BINARY, 'bloom-filter-generate-parquet.py'),
+        )
+    )
+    out += metadata + struct.pack('<I', len(metadata)) + b'PAR1'
+    with open(path, 'wb') as f:
+        f.write(out)
+
+
+if __name__ == '__main__':
+    write_file(sys.argv[1] if len(sys.argv) > 1 else 'bloom_filter.parquet')
@@ -0,0 +1,299 @@
+#include "http_block_cache.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/extension_util.hpp"
+
+namespace duckdb {
+
+//! Every block file starts with a header: the magic bytes, the length of the file key, the file key and the block size
+static constexpr uint64_t BLOCK_FILE_MAGIC = 0x4B434F4C42505448ULL; // "HTTPBLCK"
+static constexpr const char *BLOCK_FILE_EXTENSION = ".block";
+
+static idx_t GetHeaderSize(const string &file_key) {
+	return sizeof(uint64_t) * 3 + file_key.size();
+}
+
+HTTPBlockCache::HTTPBlockCache() : fs(FileSystem::CreateLocal()), max_size(0) {
+}
+
+shared_ptr<HTTPBlockCache> HTTPBlockCache::TryGet(optional_ptr<FileOpener> opener) {
+	auto db = FileOpener::TryGetDatabase(opener);
+	if (!db) {
+		return nullptr;
+	}
+	Value value;
+	if (!FileOpener::TryGetCurrentSetting(opener, "http_block_cache_directory", value) || value.IsNull()) {
+		return nullptr;
+	}
+	auto directory = value.ToString();
+	if (directory.empty()) {
+		return nullptr;
+	}
+	idx_t max_size = DBConfig::ParseMemoryLimit(DEFAULT_MAX_SIZE);
+	if (FileOpener::TryGetCurrentSetting(opener, "http_block_cache_max_size", value) && !value.IsNull()) {
+		max_size = DBConfig::ParseMemoryLimit(value.ToString());
+	}
+	auto cache = db->GetObjectCache().GetOrCreate<HTTPBlockCache>(ObjectType());
+	if (!cache) {
+		return nullptr;
+	}
+	cache->Configure(FileSystem::ExpandPath(directory, opener), max_size);
+	return cache;
+}
+
+string HTTPBlockCache::GetFileKey(const string &path, const string &etag, time_t last_modified, idx_t length) {
+	if (!etag.empty()) {
+		return path + "\n" + etag + "\n" + to_string(length);
+	}
+	if (last_modified != 0) {
+		return path + "\n" + to_string(last_modified) + "\n" + to_string(length);
+	}
+	// without a version, changes to the remote file cannot be detected
+	return string();
+}
+
+void HTTPBlockCache::Configure(const string &directory_p, idx_t max_size_p) {
+	lock_guard<mutex> guard(lock);
+	max_size = max_size_p;
+	if (directory_p != directory) {
+		directory = directory_p;
+		lru.clear();
+		blocks.clear();
+		total_size = 0;
+		if (!fs->DirectoryExists(directory)) {
+			fs->CreateDirectory(directory);
+		}
+		LoadDirectory();
+	}
+	EvictBlocks();
+}
+
+void HTTPBlockCache::LoadDirectory() {
+	// block files that were written by this or other processes before - oldest first
+	vector<pair<time_t, string>> files;
+	fs->ListFiles(directory, [&](const string &name, bool is_dir) {
+		if (is_dir || !StringUtil::EndsWith(name, BLOCK_FILE_EXTENSION)) {
+			return;
+		}
+		files.emplace_back(0, name);
+	});
+	vector<idx_t> sizes;
+	for (auto &file : files) {
+		idx_t size = 0;
+		try {
+			auto handle = fs->OpenFile(fs->JoinPath(directory, file.second),
+			                           FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+			if (handle) {
+				file.first = fs->GetLastModifiedTime(*handle);
+				size = NumericCast<idx_t>(fs->GetFileSize(*handle));
+			}
+		} catch (std::exception &ex) {
+			// the file was removed in the mean time
+		}
+		sizes.push_back(size);
+	}
+	vector<idx_t> order(files.size());
+	for (idx_t i = 0; i < order.size(); i++) {
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(),
+	                 [&](const idx_t &lhs, const idx_t &rhs) { return files[lhs].first < files[rhs].first; });
+	for (auto &idx : order) {
+		if (sizes[idx] > 0) {
+			Touch(files[idx].second, sizes[idx]);
+		}
+	}
+}
+
+string HTTPBlockCache::GetBlockPath(const string &file_key, idx_t block_idx) {
+	auto file_name =
+	    to_string(Hash(file_key.c_str(), file_key.size())) + "_" + to_string(block_idx) + BLOCK_FILE_EXTENSION;
+	lock_guard<mutex> guard(lock);
+	return fs->JoinPath(directory, file_name);
+}
+
+void HTTPBlockCache::Touch(const string &file_name, idx_t size) {
+	auto entry = blocks.find(file_name);
+	if (entry != blocks.end()) {
+		lru.erase(entry->second.lru_position);
+		total_size -= entry->second.size;
+		blocks.erase(entry);
+	}
+	CachedBlock block;
+	block.size = size;
+	block.lru_position = lru.insert(lru.end(), file_name);
+	total_size += size;
+	blocks.emplace(file_name, block);
+}
+
+void HTTPBlockCache::Remove(const string &file_name) {
+	auto entry = blocks.find(file_name);
+	if (entry == blocks.end()) {
+		return;
+	}
+	lru.erase(entry->second.lru_position);
+	total_size -= entry->second.size;
+	blocks.erase(entry);
+}
+
+void HTTPBlockCache::EvictBlocks() {
+	while (!lru.empty() && total_size > max_size) {
+		auto file_name = lru.front();
+		Remove(file_name);
+		try {
+			fs->RemoveFile(fs->JoinPath(directory, file_name));
+		} catch (std::exception &ex) {
+			// another process might have evicted the block already
+		}
+		evictions++;
+	}
+}
+
+bool HTTPBlockCache::Read(const string &file_key, idx_t block_idx, idx_t block_size, data_ptr_t buffer,
+                          idx_t offset_in_block, idx_t nr_bytes) {
+	D_ASSERT(offset_in_block + nr_bytes <= block_size);
+	auto path = GetBlockPath(file_key, block_idx);
+	auto file_name = StringUtil::GetFileName(path);
+	auto header_size = GetHeaderSize(file_key);
+	try {
+		auto handle = fs->OpenFile(path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		if (handle && NumericCast<idx_t>(handle->GetFileSize()) == header_size + block_size) {
+			auto header = make_unsafe_uniq_array_uninitialized<data_t>(header_size);
+			handle->Read(header.get(), header_size, 0);
+			auto key_length = Load<uint64_t>(header.get() + sizeof(uint64_t));
+			// the file name is a hash of the key: verify that the block belongs to this version of this file
+			if (Load<uint64_t>(header.get()) == BLOCK_FILE_MAGIC && key_length == file_key.size() &&
+			    memcmp(header.get() + sizeof(uint64_t) * 2, file_key.c_str(), key_length) == 0 &&
+			    Load<uint64_t>(header.get() + sizeof(uint64_t) * 2 + key_length) == block_size) {
+				handle->Read(buffer, nr_bytes, header_size + offset_in_block);
+				hits++;
+				bytes_read += nr_bytes;
+				lock_guard<mutex> guard(lock);
+				Touch(file_name, header_size + block_size);
+				return true;
+			}
+		}
+	} catch (std::exception &ex) {
+		// e.g., the block was evicted by another process while we were reading it
+	}
+	misses++;
+	lock_guard<mutex> guard(lock);
+	Remove(file_name);
+	return false;
+}
+
+void HTTPBlockCache::Write(const string &file_key, idx_t block_idx, const_data_ptr_t data, idx_t block_size) {
+	auto path = GetBlockPath(file_key, block_idx);
+	auto file_name = StringUtil::GetFileName(path);
+	auto header_size = GetHeaderSize(file_key);
+	if (header_size + block_size > max_size) {
+		return;
+	}
+	auto header = make_unsafe_uniq_array_uninitialized<data_t>(header_size);
+	Store<uint64_t>(BLOCK_FILE_MAGIC, header.get());
+	Store<uint64_t>(file_key.size(), header.get() + sizeof(uint64_t));
+	memcpy(header.get() + sizeof(uint64_t) * 2, file_key.c_str(), file_key.size());
+	Store<uint64_t>(block_size, header.get() + sizeof(uint64_t) * 2 + file_key.size());
+
+	// write the block to a temporary file and move it into place, so other processes never read a partial block
+	auto temp_path = path + "." + UUID::ToString(UUID::GenerateRandomUUID()) + ".tmp";
+	try {
+		auto handle =
+		    fs->OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		handle->Write(header.get(), header_size, 0);
+		handle->Write(const_cast<data_ptr_t>(data), block_size, header_size);
+		handle->Close();
+		handle.reset();
+		fs->MoveFile(temp_path, path);
+	} catch (std::exception &ex) {
+		// caching is best-effort: e.g., the disk is full
+		try {
+			fs->RemoveFile(temp_path);
+		} catch (...) {
+		}
+		return;
+	}
+	bytes_written += block_size;
+	lock_guard<mutex> guard(lock);
+	Touch(file_name, header_size + block_size);
+	EvictBlocks();
+}
+
+void HTTPBlockCache::GetUsage(idx_t &total_size_p, idx_t &block_count) {
+	lock_guard<mutex> guard(lock);
+	total_size_p = total_size;
+	block_count = blocks.size();
+}
+
+//===--------------------------------------------------------------------===//
+// http_block_cache() table function
+//===--------------------------------------------------------------------===//
+struct HTTPBlockCacheFunctionData : public GlobalTableFunctionState {
+	bool finished = false;
+};
+
+static unique_ptr<FunctionData> HTTPBlockCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                   vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("directory");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("max_size");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("size");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("block_count");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("bytes_read");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("bytes_written");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	return nullptr;
+}
+
+static unique_ptr<GlobalTableFunctionState> HTTPBlockCacheInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<HTTPBlockCacheFunctionData>();
+}
+
+static void HTTPBlockCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<HTTPBlockCacheFunctionData>();
+	if (data.finished) {
+		return;
+	}
+	data.finished = true;
+	auto cache = ObjectCache::GetObjectCache(context).Get<HTTPBlockCache>(HTTPBlockCache::ObjectType());
+	if (!cache) {
+		// no remote file was read with the block cache enabled yet
+		return;
+	}
+	idx_t total_size, block_count;
+	cache->GetUsage(total_size, block_count);
+	idx_t col = 0;
+	output.SetValue(col++, 0, Value(cache->GetDirectory()));
+	output.SetValue(col++, 0, Value::UBIGINT(cache->GetMaxSize()));
+	output.SetValue(col++, 0, Value::UBIGINT(total_size));
+	output.SetValue(col++, 0, Value::UBIGINT(block_count));
+	output.SetValue(col++, 0, Value::UBIGINT(cache->hits));
+	output.SetValue(col++, 0, Value::UBIGINT(cache->misses));
+	output.SetValue(col++, 0, Value::UBIGINT(cache->bytes_read));
+	output.SetValue(col++, 0, Value::UBIGINT(cache->bytes_written));
+	output.SetValue(col++, 0, Value::UBIGINT(cache->evictions));
+	output.SetCardinality(1);
+}
+
+void HTTPBlockCache::RegisterFunctions(DatabaseInstance &instance) {
+	TableFunction function("http_block_cache", {}, HTTPBlockCacheFunction, HTTPBlockCacheBind, HTTPBlockCacheInit);
+	ExtensionUtil::RegisterFunction(instance, function);
+}
+
+} // namespace duckdb
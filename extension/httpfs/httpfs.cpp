@@ -439,8 +439,8 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 }
 
 HTTPFileHandle::HTTPFileHandle(FileSystem &fs, const string &path, FileOpenFlags flags, const HTTPParams &http_params)
-    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), buffer_available(0), buffer_idx(0),
-      file_offset(0), buffer_start(0), buffer_end(0) {
+    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), last_modified(0), buffer_available(0),
+      buffer_idx(0), file_offset(0), buffer_start(0), buffer_end(0) {
 }
 
 unique_ptr<HTTPFileHandle> HTTPFileSystem::CreateHandle(const string &path, FileOpenFlags flags,
@@ -505,6 +505,11 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 		hfh.file_offset = location + nr_bytes;
 		return;
 	}
+	if (hfh.block_cache) {
+		ReadCachedBlocks(hfh, data_ptr_cast(buffer), NumericCast<idx_t>(nr_bytes), location);
+		hfh.file_offset = location + nr_bytes;
+		return;
+	}
 
 	idx_t to_read = nr_bytes;
 	idx_t buffer_offset = 0;
@@ -565,6 +570,31 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	}
 }
 
+void HTTPFileSystem::ReadCachedBlocks(HTTPFileHandle &hfh, data_ptr_t buffer, idx_t nr_bytes, idx_t location) {
+	D_ASSERT(location + nr_bytes <= hfh.length);
+	auto &block_cache = *hfh.block_cache;
+	unsafe_unique_array<data_t> block_buffer;
+	while (nr_bytes > 0) {
+		auto block_idx = location / HTTPBlockCache::BLOCK_SIZE;
+		auto block_start = block_idx * HTTPBlockCache::BLOCK_SIZE;
+		auto block_length = MinValue<idx_t>(HTTPBlockCache::BLOCK_SIZE, hfh.length - block_start);
+		auto offset_in_block = location - block_start;
+		auto to_read = MinValue<idx_t>(nr_bytes, block_length - offset_in_block);
+		if (!block_cache.Read(hfh.block_cache_key, block_idx, block_length, buffer, offset_in_block, to_read)) {
+			// download the full block, so that later reads of (other parts of) the block are served from disk
+			if (!block_buffer) {
+				block_buffer = make_unsafe_uniq_array_uninitialized<data_t>(HTTPBlockCache::BLOCK_SIZE);
+			}
+			GetRangeRequest(hfh, hfh.path, {}, block_start, char_ptr_cast(block_buffer.get()), block_length);
+			block_cache.Write(hfh.block_cache_key, block_idx, block_buffer.get(), block_length);
+			memcpy(buffer, block_buffer.get() + offset_in_block, to_read);
+		}
+		buffer += to_read;
+		location += to_read;
+		nr_bytes -= to_read;
+	}
+}
+
 int64_t HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	auto &hfh = (HTTPFileHandle &)handle;
 	idx_t max_read = hfh.length - hfh.file_offset;
@@ -672,10 +702,12 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		if (found) {
 			last_modified = value.last_modified;
 			length = value.length;
+			etag = value.etag;
 
 			if (flags.OpenForReading()) {
 				read_buffer = duckdb::unique_ptr<data_t[]>(new data_t[READ_BUFFER_LEN]);
 			}
+			InitializeBlockCache(opener);
 			return;
 		}
 
@@ -781,9 +813,27 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		tm.tm_isdst = 0;
 		last_modified = mktime(&tm);
 	}
+	if (res->headers.find("ETag") != res->headers.end()) {
+		etag = res->headers["ETag"];
+	}
 
 	if (should_write_cache) {
-		current_cache->Insert(path, {length, last_modified});
+		current_cache->Insert(path, {length, last_modified, etag});
+	}
+	InitializeBlockCache(opener);
+}
+
+void HTTPFileHandle::InitializeBlockCache(optional_ptr<FileOpener> opener) {
+	if (!flags.OpenForReading() || flags.OpenForWriting() || cached_file_handle || length == 0) {
+		return;
+	}
+	auto file_key = HTTPBlockCache::GetFileKey(path, etag, last_modified, length);
+	if (file_key.empty()) {
+		return;
+	}
+	block_cache = HTTPBlockCache::TryGet(opener);
+	if (block_cache) {
+		block_cache_key = std::move(file_key);
 	}
 }
 
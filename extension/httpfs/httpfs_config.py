@@ -15,6 +15,7 @@ source_files = [
             'crypto.cpp',
             'hffs.cpp',
             'http_state.cpp',
+            'http_block_cache.cpp',
             'httpfs.cpp',
             'httpfs_extension.cpp',
             's3fs.cpp',
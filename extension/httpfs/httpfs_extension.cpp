@@ -7,6 +7,7 @@
 #include "s3fs.hpp"
 #include "hffs.hpp"
 #include "crypto.hpp"
+#include "http_block_cache.hpp"
 
 namespace duckdb {
 
@@ -58,6 +59,13 @@ static void LoadInternal(DatabaseInstance &instance) {
 	config.AddExtensionOption("s3_uploader_thread_limit", "S3 Uploader global thread limit", LogicalType::UBIGINT,
 	                          Value(50));
 
+	// On-disk block cache
+	config.AddExtensionOption("http_block_cache_directory",
+	                          "Directory of the persistent cache of blocks of remote files (disabled when empty)",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_block_cache_max_size", "Maximum size of the persistent cache of remote files",
+	                          LogicalType::VARCHAR, Value(HTTPBlockCache::DEFAULT_MAX_SIZE));
+
 	// HuggingFace options
 	config.AddExtensionOption("hf_max_per_page", "Debug option to limit number of items returned in list requests",
 	                          LogicalType::UBIGINT, Value::UBIGINT(0));
@@ -67,6 +75,7 @@ static void LoadInternal(DatabaseInstance &instance) {
 
 	CreateS3SecretFunctions::Register(instance);
 	CreateBearerTokenFunctions::Register(instance);
+	HTTPBlockCache::RegisterFunctions(instance);
 
 	// set pointer to OpenSSL encryption state
 	config.encryption_util = make_shared_ptr<AESGCMStateSSLFactory>();
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/file_opener.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+
+//! Persistent cache of fixed-size blocks of remote files on the local disk.
+//! Every block is stored in its own file in the cache directory. Files are written to a temporary file first and then
+//! moved into place, so that concurrent processes that share the directory never observe partially written blocks.
+//! Every block file starts with the key of the remote file (its URL and version, i.e. the ETag or last modified time
+//! and size), which is verified when the block is read, so that blocks of changed files are never returned.
+class HTTPBlockCache : public ObjectCacheEntry {
+public:
+	//! The size of the cached blocks
+	static constexpr idx_t BLOCK_SIZE = 1ULL << 20ULL;
+	//! The default maximum size of the cache directory
+	static constexpr const char *DEFAULT_MAX_SIZE = "1GB";
+
+	HTTPBlockCache();
+
+public:
+	//! Returns the block cache of the database, or nullptr if it is disabled (no directory is set)
+	static shared_ptr<HTTPBlockCache> TryGet(optional_ptr<FileOpener> opener);
+
+	//! Returns the key that identifies a version of a remote file, or an empty string if the version cannot be
+	//! determined (and the file cannot be cached)
+	static string GetFileKey(const string &path, const string &etag, time_t last_modified, idx_t length);
+	//! Reads 'nr_bytes' at 'offset_in_block' from a cached block into the buffer, returns false if it is not cached
+	bool Read(const string &file_key, idx_t block_idx, idx_t block_size, data_ptr_t buffer, idx_t offset_in_block,
+	          idx_t nr_bytes);
+	//! Stores a block in the cache (evicting the least recently used blocks if required)
+	void Write(const string &file_key, idx_t block_idx, const_data_ptr_t data, idx_t block_size);
+
+	string GetDirectory() {
+		lock_guard<mutex> guard(lock);
+		return directory;
+	}
+	idx_t GetMaxSize() const {
+		return max_size;
+	}
+	//! Returns the total size and number of the block files that this process knows about
+	void GetUsage(idx_t &total_size, idx_t &block_count);
+	//! Registers the http_block_cache() table function
+	static void RegisterFunctions(DatabaseInstance &instance);
+
+	static string ObjectType() {
+		return "http_block_cache";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+public:
+	atomic<idx_t> hits {0};
+	atomic<idx_t> misses {0};
+	atomic<idx_t> bytes_read {0};
+	atomic<idx_t> bytes_written {0};
+	atomic<idx_t> evictions {0};
+
+private:
+	struct CachedBlock {
+		idx_t size;
+		list<string>::iterator lru_position;
+	};
+
+	//! Sets the directory and size limit, (re)loading the contents of the directory when it changes
+	void Configure(const string &directory, idx_t max_size);
+	void LoadDirectory();
+	string GetBlockPath(const string &file_key, idx_t block_idx);
+	//! Marks a block file as most recently used
+	void Touch(const string &file_name, idx_t size);
+	void Remove(const string &file_name);
+	void EvictBlocks();
+
+private:
+	unique_ptr<FileSystem> fs;
+	mutex lock;
+	string directory;
+	atomic<idx_t> max_size;
+	//! The total size of the cached block files
+	idx_t total_size = 0;
+	//! The block files, in least recently used order
+	list<string> lru;
+	unordered_map<string, CachedBlock> blocks;
+};
+
+} // namespace duckdb
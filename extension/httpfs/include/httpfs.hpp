@@ -7,6 +7,7 @@
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "http_metadata_cache.hpp"
+#include "http_block_cache.hpp"
 
 namespace duckdb_httplib_openssl {
 struct Response;
@@ -98,6 +99,11 @@ public:
 	FileOpenFlags flags;
 	idx_t length;
 	time_t last_modified;
+	string etag;
+
+	// When the on-disk block cache is enabled, reads are served from (and stored in) the block cache
+	shared_ptr<HTTPBlockCache> block_cache;
+	string block_cache_key;
 
 	// When using full file download, the full file will be written to a cached file handle
 	unique_ptr<CachedFileHandle> cached_file_handle;
@@ -116,6 +122,8 @@ public:
 	shared_ptr<HTTPState> state;
 
 	void AddHeaders(HeaderMap &map);
+	//! Sets up the on-disk block cache for reading (if enabled and the version of the file is known)
+	void InitializeBlockCache(optional_ptr<FileOpener> opener);
 
 	// Get a Client to run requests over
 	unique_ptr<duckdb_httplib_openssl::Client> GetClient(optional_ptr<ClientContext> client_context);
@@ -196,6 +204,9 @@ protected:
 	virtual duckdb::unique_ptr<HTTPFileHandle> CreateHandle(const string &path, FileOpenFlags flags,
 	                                                        optional_ptr<FileOpener> opener);
 
+	//! Reads a range of the file through the on-disk block cache
+	void ReadCachedBlocks(HTTPFileHandle &hfh, data_ptr_t buffer, idx_t nr_bytes, idx_t location);
+
 	static duckdb::unique_ptr<ResponseWrapper>
 	RunRequestWithRetry(const std::function<duckdb_httplib_openssl::Result(void)> &request, string &url, string method,
 	                    const HTTPParams &params, const std::function<void(void)> &retry_cb = {});
@@ -238,6 +238,27 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	page_rows_available = 0;
+	pending_skips = 0;
+	page_locations.clear();
+}
+
+void ColumnReader::SetPageLocations(vector<PageLocation> page_locations_p) {
+	D_ASSERT(chunk);
+	if (HasRepeats() || page_locations_p.empty() || page_locations_p[0].first_row_index != 0) {
+		// pages can only be skipped by row for non-nested columns
+		return;
+	}
+	for (idx_t page_idx = 1; page_idx < page_locations_p.size(); page_idx++) {
+		auto &prev = page_locations_p[page_idx - 1];
+		auto &page = page_locations_p[page_idx];
+		if (page.first_row_index <= prev.first_row_index || page.offset <= prev.offset ||
+		    page.first_row_index >= chunk->meta_data.num_values) {
+			// malformed offset index - ignore it
+			return;
+		}
+	}
+	page_locations = std::move(page_locations_p);
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -603,9 +624,49 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (page_locations.empty()) {
+		return 0;
+	}
+	auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+	auto target_row = current_row + num_values;
+	// find the last page that starts at or before the target row
+	auto entry = std::upper_bound(
+	    page_locations.begin(), page_locations.end(), target_row,
+	    [](idx_t row, const PageLocation &page) { return row < NumericCast<idx_t>(page.first_row_index); });
+	D_ASSERT(entry != page_locations.begin());
+	auto &target_page = *(entry - 1);
+	auto page_start = NumericCast<idx_t>(target_page.first_row_index);
+	if (page_start <= current_row) {
+		// the target row is in the current page
+		return 0;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	if (chunk_read_offset < NumericCast<idx_t>(page_locations[0].offset) && page_rows_available == 0) {
+		// the dictionary page precedes the first data page, read it before we skip over it
+		trans.SetLocation(chunk_read_offset);
+		PrepareRead(none_filter);
+		chunk_read_offset = trans.GetLocation();
+		if (page_rows_available > 0) {
+			// this was a data page - the offset index does not match the column chunk
+			page_locations.clear();
+			return 0;
+		}
+	}
+	auto skip_count = page_start - current_row;
+	chunk_read_offset = NumericCast<idx_t>(target_page.offset);
+	trans.SetLocation(chunk_read_offset);
+	page_rows_available = 0;
+	group_rows_available -= skip_count;
+	return skip_count;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	// skip the pages that we don't need at all without reading them
+	num_values -= SkipPages(num_values);
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
@@ -1,6 +1,7 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -30,12 +31,16 @@ namespace duckdb {
 using namespace duckdb_parquet; // NOLINT
 using namespace duckdb_miniz;   // NOLINT
 
+using duckdb_parquet::format::BoundaryOrder;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::Encoding;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::PageType;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::Type;
@@ -88,6 +93,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -340,6 +348,9 @@ struct PageWriteInformation {
 	size_t compressed_size;
 	data_ptr_t compressed_data;
 	unique_ptr<data_t[]> compressed_buf;
+	//! The statistics and null count of this page, only gathered when writing a page index
+	unique_ptr<ColumnWriterStatistics> page_stats;
+	idx_t null_count = 0;
 };
 
 class BasicColumnWriterState : public ColumnWriterState {
@@ -356,6 +367,10 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+	//! Whether or not a page index (ColumnIndex and OffsetIndex) is written for this column chunk
+	bool write_page_index = false;
+	//! The hashes for the Bloom filter of this column chunk (if any)
+	unique_ptr<ParquetBloomFilterBuilder> bloom_filter;
 };
 
 //===--------------------------------------------------------------------===//
@@ -374,6 +389,9 @@ public:
 	//! We limit the uncompressed page size to 100MB
 	//! The max size in Parquet is 2GB, but we choose a more conservative limit
 	static constexpr const idx_t MAX_UNCOMPRESSED_PAGE_SIZE = 100000000;
+	//! When writing a page index we also limit the number of rows in a page, so that readers can skip parts of a
+	//! row group based on the statistics of its pages
+	static constexpr const idx_t MAX_PAGE_ROWS_WITH_PAGE_INDEX = 20000;
 	//! Dictionary pages must be below 2GB. Unlike data pages, there's only one dictionary page.
 	//! For this reason we go with a much higher, but still a conservative upper bound of 1GB;
 	static constexpr const idx_t MAX_UNCOMPRESSED_DICT_PAGE_SIZE = 1e9;
@@ -416,6 +434,10 @@ protected:
 	//! Writes a (subset of a) vector to the specified serializer. Only used for scalar types.
 	virtual void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                         Vector &vector, idx_t chunk_start, idx_t chunk_end) = 0;
+	//! Adds the hashes of the plain-encoded values of a vector to the Bloom filter. Types that do not override this
+	//! do not get a Bloom filter.
+	virtual void UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t count) {
+	}
 
 	virtual bool HasDictionary(BasicColumnWriterState &state_p) {
 		return false;
@@ -427,6 +449,8 @@ protected:
 
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
+	//! Creates the ColumnIndex of the chunk from the page statistics, or nullptr if a page has no statistics
+	unique_ptr<ColumnIndex> CreateColumnIndex(BasicColumnWriterState &state);
 };
 
 unique_ptr<ColumnWriterState> BasicColumnWriter::InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) {
@@ -465,7 +489,14 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 
 	idx_t vector_index = 0;
 	reference<PageInformation> page_info_ref = state.page_info.back();
+	const bool limit_page_rows = writer.WritePageIndex() && max_repeat == 0;
 	for (idx_t i = start; i < vcount; i++) {
+		if (limit_page_rows && page_info_ref.get().row_count >= MAX_PAGE_ROWS_WITH_PAGE_INDEX) {
+			PageInformation new_info;
+			new_info.offset = page_info_ref.get().offset + page_info_ref.get().row_count;
+			state.page_info.push_back(new_info);
+			page_info_ref = state.page_info.back();
+		}
 		auto &page_info = page_info_ref.get();
 		page_info.row_count++;
 		col_chunk.meta_data.num_values++;
@@ -495,6 +526,11 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	// page indexes are only written for flat columns, since their pages always start at a row boundary
+	state.write_page_index = writer.WritePageIndex() && max_repeat == 0;
+	if (writer.WriteBloomFilter(schema_path)) {
+		state.bloom_filter = make_uniq<ParquetBloomFilterBuilder>();
+	}
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -524,6 +560,13 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
 
+		if (state.write_page_index) {
+			write_info.page_stats = InitializeStatsState();
+			for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+				write_info.null_count += state.definition_levels[i] < max_define;
+			}
+		}
+
 		state.write_info.push_back(std::move(write_info));
 	}
 
@@ -590,6 +633,9 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	if (write_info.page_stats) {
+		state.stats_state->Merge(*write_info.page_stats);
+	}
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.GetPosition() > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -622,6 +668,9 @@ idx_t BasicColumnWriter::GetRowSize(const Vector &vector, const idx_t index,
 
 void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t count) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
+	if (state.bloom_filter) {
+		UpdateBloomFilter(state, vector, count);
+	}
 
 	idx_t remaining = count;
 	idx_t offset = 0;
@@ -634,8 +683,9 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
-		            offset + write_count);
+		// when writing a page index we gather the statistics per page, and merge them when the page is flushed
+		auto stats = write_info.page_stats ? write_info.page_stats.get() : state.stats_state.get();
+		WriteVector(temp_writer, stats, write_info.page_state.get(), vector, offset, offset + write_count);
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -709,7 +759,12 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	SetParquetStatistics(state, column_chunk);
 
 	// write the individual pages to disk
+	unique_ptr<OffsetIndex> offset_index;
+	if (state.write_page_index) {
+		offset_index = make_uniq<OffsetIndex>();
+	}
 	idx_t total_uncompressed_size = 0;
+	idx_t first_row_index = 0;
 	for (auto &write_info : state.write_info) {
 		// set the data page offset whenever we see the *first* data page
 		if (column_chunk.meta_data.data_page_offset == 0 && (write_info.page_header.type == PageType::DATA_PAGE ||
@@ -724,10 +779,61 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+
+		if (offset_index && write_info.page_header.type == PageType::DATA_PAGE) {
+			PageLocation page_location;
+			page_location.offset = UnsafeNumericCast<int64_t>(header_start_offset);
+			page_location.compressed_page_size =
+			    UnsafeNumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+			page_location.first_row_index = UnsafeNumericCast<int64_t>(first_row_index);
+			offset_index->page_locations.push_back(page_location);
+			first_row_index += write_info.max_write_count;
+		}
 	}
 	column_chunk.meta_data.total_compressed_size =
 	    UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten() - start_offset);
 	column_chunk.meta_data.total_uncompressed_size = UnsafeNumericCast<int64_t>(total_uncompressed_size);
+
+	// the page indexes and the Bloom filter are written after the last row group
+	unique_ptr<ColumnIndex> column_index;
+	if (state.write_page_index) {
+		column_index = CreateColumnIndex(state);
+	}
+	unique_ptr<ParquetBloomFilter> bloom_filter;
+	if (state.bloom_filter) {
+		bloom_filter = state.bloom_filter->Finalize();
+	}
+	if (column_index || offset_index || bloom_filter) {
+		writer.AddColumnChunkIndexes(state.col_idx, std::move(column_index), std::move(offset_index),
+		                             std::move(bloom_filter));
+	}
+}
+
+unique_ptr<ColumnIndex> BasicColumnWriter::CreateColumnIndex(BasicColumnWriterState &state) {
+	auto column_index = make_uniq<ColumnIndex>();
+	for (auto &write_info : state.write_info) {
+		if (write_info.page_header.type != PageType::DATA_PAGE) {
+			continue;
+		}
+		D_ASSERT(write_info.page_stats);
+		// a page that only contains NULL values has empty min/max values
+		bool null_page = write_info.null_count == write_info.max_write_count;
+		if (null_page) {
+			column_index->min_values.emplace_back();
+			column_index->max_values.emplace_back();
+		} else if (write_info.page_stats->HasStats()) {
+			column_index->min_values.push_back(write_info.page_stats->GetMinValue());
+			column_index->max_values.push_back(write_info.page_stats->GetMaxValue());
+		} else {
+			// we don't have statistics for this type (or the values are too large)
+			return nullptr;
+		}
+		column_index->null_pages.push_back(null_page);
+		column_index->null_counts.push_back(UnsafeNumericCast<int64_t>(write_info.null_count));
+	}
+	column_index->boundary_order = BoundaryOrder::UNORDERED;
+	column_index->__isset.null_counts = true;
+	return column_index;
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -797,6 +903,15 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -920,6 +1035,18 @@ public:
 		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
 	}
 
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t count) override {
+		auto &mask = FlatVector::Validity(vector);
+		const auto *ptr = FlatVector::GetData<SRC>(vector);
+		for (idx_t r = 0; r < count; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			state.bloom_filter->AddHash(ParquetBloomFilter::Hash(const_data_ptr_cast(&target_value), sizeof(TGT)));
+		}
+	}
+
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
 		return sizeof(TGT);
 	}
@@ -953,6 +1080,11 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -1084,6 +1216,13 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1115,6 +1254,18 @@ public:
 		}
 	}
 
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t count) override {
+		auto &mask = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<hugeint_t>(vector);
+		data_t temp_buffer[16];
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				WriteParquetDecimal(ptr[r], temp_buffer);
+				state.bloom_filter->AddHash(ParquetBloomFilter::Hash(temp_buffer, 16));
+			}
+		}
+	}
+
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
 		return sizeof(hugeint_t);
 	}
@@ -1162,6 +1313,18 @@ public:
 		}
 	}
 
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t count) override {
+		auto &mask = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<hugeint_t>(vector);
+		data_t temp_buffer[PARQUET_UUID_SIZE];
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				WriteParquetUUID(ptr[r], temp_buffer);
+				state.bloom_filter->AddHash(ParquetBloomFilter::Hash(temp_buffer, PARQUET_UUID_SIZE));
+			}
+		}
+	}
+
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
 		return PARQUET_UUID_SIZE;
 	}
@@ -1266,6 +1429,18 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.values_too_big) {
+			values_too_big = true;
+			has_stats = false;
+			min = string();
+			max = string();
+		} else if (other.has_stats) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1292,8 +1467,9 @@ public:
 
 class StringWriterPageState : public ColumnWriterPageState {
 public:
-	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values)
-	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false) {
+	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values, bool gather_stats)
+	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false),
+	      gather_stats(gather_stats) {
 		D_ASSERT(IsDictionaryEncoded() || (bit_width == 0 && dictionary.empty()));
 	}
 
@@ -1305,6 +1481,8 @@ public:
 	const string_map_t<uint32_t> &dictionary;
 	RleBpEncoder encoder;
 	bool written_value;
+	//! Whether or not statistics are gathered for dictionary pages (they are otherwise taken from the dictionary)
+	bool gather_stats;
 };
 
 class StringColumnWriter : public BasicColumnWriter {
@@ -1409,6 +1587,9 @@ public:
 					continue;
 				}
 				auto value_index = page_state.dictionary.at(ptr[r]);
+				if (page_state.gather_stats) {
+					stats.Update(ptr[r]);
+				}
 				if (!page_state.written_value) {
 					// first value
 					// write the bit-width as a one-byte entry
@@ -1435,7 +1616,23 @@ public:
 
 	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
+		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary, state.write_page_index);
+	}
+
+	void UpdateBloomFilter(BasicColumnWriterState &state_p, Vector &vector, idx_t count) override {
+		auto &state = state_p.Cast<StringColumnWriterState>();
+		if (state.IsDictionaryEncoded()) {
+			// the hashes are computed from the dictionary instead
+			return;
+		}
+		auto &mask = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<string_t>(vector);
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				state.bloom_filter->AddHash(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+			}
+		}
 	}
 
 	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
@@ -1484,8 +1681,12 @@ public:
 		    MaxValue<idx_t>(NextPowerOfTwo(state.estimated_dict_page_size), MemoryStream::DEFAULT_INITIAL_CAPACITY));
 		for (idx_t r = 0; r < values.size(); r++) {
 			auto &value = values[r];
-			// update the statistics
+			// update the statistics and the Bloom filter
 			stats.Update(value);
+			if (state.bloom_filter) {
+				state.bloom_filter->AddHash(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(value.GetData()), value.GetSize()));
+			}
 			// write this string value to the dictionary
 			temp_writer->Write<uint32_t>(value.GetSize());
 			temp_writer->WriteData(const_data_ptr_cast((value.GetData())), value.GetSize());
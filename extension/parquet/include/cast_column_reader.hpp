@@ -45,6 +45,10 @@ public:
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 		child_reader->RegisterPrefetch(transport, allow_merge);
 	}
+
+	void SetPageLocations(vector<PageLocation> page_locations_p) override {
+		child_reader->SetPageLocations(std::move(page_locations_p));
+	}
 };
 
 } // namespace duckdb
@@ -33,6 +33,7 @@ using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
 
@@ -69,6 +70,9 @@ public:
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
+	//! Sets the page locations of the current column chunk (from its OffsetIndex), which allows skipping entire pages
+	//! without reading them
+	virtual void SetPageLocations(vector<PageLocation> page_locations_p);
 
 	template <class VALUE_TYPE, class CONVERSION>
 	void PlainTemplated(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
@@ -166,6 +170,8 @@ private:
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
+	//! Skips the pages that end before the given number of values, returns the number of values that were skipped
+	idx_t SkipPages(idx_t num_values);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
 
@@ -175,6 +181,7 @@ private:
 	idx_t page_rows_available;
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
+	vector<PageLocation> page_locations;
 
 	shared_ptr<ResizeableBuffer> block;
 
@@ -0,0 +1,103 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#endif
+#include "parquet_types.h"
+
+namespace duckdb_apache {
+namespace thrift {
+namespace protocol {
+class TProtocol;
+} // namespace protocol
+} // namespace thrift
+} // namespace duckdb_apache
+
+namespace duckdb {
+
+using duckdb_parquet::format::SchemaElement;
+
+//! A split block Bloom filter as defined by the Parquet specification. The filter consists of blocks of 256 bits,
+//! every value sets (and is probed against) one bit in each of the eight 32-bit words of a single block.
+//! Values are hashed with XXH64 (seed 0) over their plain encoding.
+class ParquetBloomFilter {
+public:
+	//! The number of 32-bit words in a block
+	static constexpr idx_t WORDS_PER_BLOCK = 8;
+	//! The size of a block in bytes
+	static constexpr idx_t BYTES_PER_BLOCK = WORDS_PER_BLOCK * sizeof(uint32_t);
+	//! The maximum size of a filter that we read
+	static constexpr idx_t MAX_FILTER_SIZE = 128ULL * 1024ULL * 1024ULL;
+	//! The maximum size of a filter that we write
+	static constexpr idx_t MAX_WRITE_FILTER_SIZE = 1024ULL * 1024ULL;
+	//! The false positive ratio that written filters are sized for
+	static constexpr double DEFAULT_FALSE_POSITIVE_RATIO = 0.01;
+
+	explicit ParquetBloomFilter(idx_t num_bytes);
+
+public:
+	//! Reads a filter (header and bitset) at the current location of the protocol's transport. Returns nullptr if the
+	//! filter uses an algorithm, hash or compression that we do not support.
+	static unique_ptr<ParquetBloomFilter> Read(duckdb_apache::thrift::protocol::TProtocol &protocol);
+
+	//! Writes the filter (header and bitset) to the protocol
+	void Write(duckdb_apache::thrift::protocol::TProtocol &protocol) const;
+	//! Returns the size of a filter that holds the given number of distinct values with the false positive ratio
+	static idx_t OptimalNumBytes(idx_t distinct_values, double false_positive_ratio);
+
+	//! Hashes plain-encoded bytes
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+	//! Computes the hash of a constant for a column with the given schema and type. Returns false if the constant
+	//! cannot be hashed (e.g. because its physical representation in the file is not known).
+	static bool HashValue(const Value &value, const LogicalType &type, const SchemaElement &schema, uint64_t &result);
+
+	//! Adds the value with the given hash to the filter
+	void InsertHash(uint64_t hash);
+	//! Returns whether the value with the given hash might be present in the filter
+	bool FindHash(uint64_t hash) const;
+	//! Returns false if the filter proves that no value in the column chunk can pass the table filter
+	bool CheckFilter(const TableFilter &filter, const LogicalType &type, const SchemaElement &schema) const;
+
+	idx_t SizeInBytes() const {
+		return block_count * BYTES_PER_BLOCK;
+	}
+
+private:
+	idx_t GetBlockIndex(uint64_t hash) const;
+	static void ComputeMask(uint64_t hash, uint32_t mask[]);
+
+private:
+	idx_t block_count;
+	unsafe_unique_array<uint32_t> blocks;
+};
+
+//! Collects the hashes of the values of a column chunk while it is written, so that the Bloom filter can be sized
+//! for the number of distinct values once the chunk is complete
+class ParquetBloomFilterBuilder {
+public:
+	//! The number of distinct hashes after which we stop collecting and insert into a filter of the maximum size
+	static constexpr idx_t MAX_COLLECTED_HASHES = 1ULL << 19ULL;
+
+public:
+	void AddHash(uint64_t hash);
+	//! Builds the filter, returns nullptr if no values were added
+	unique_ptr<ParquetBloomFilter> Finalize();
+
+private:
+	unordered_set<uint64_t> hashes;
+	//! Once too many distinct hashes are collected, they are inserted into a maximum size filter directly
+	unique_ptr<ParquetBloomFilter> filter;
+};
+
+} // namespace duckdb
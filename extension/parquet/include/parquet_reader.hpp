@@ -48,6 +48,12 @@ struct ParquetReaderPrefetchConfig {
 	static constexpr double WHOLE_GROUP_PREFETCH_MINIMUM_SCAN = 0.95;
 };
 
+//! A range of rows [start, end) within a row group
+struct ParquetRowRange {
+	idx_t start;
+	idx_t end;
+};
+
 struct ParquetReaderScanState {
 	vector<idx_t> group_idx_list;
 	int64_t current_group;
@@ -64,6 +70,12 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! Whether the page indexes of the filtered columns restrict the rows of the current row group that are scanned
+	bool has_row_ranges = false;
+	//! The (sorted, disjoint) row ranges of the current row group that may contain rows that pass the filters
+	vector<ParquetRowRange> row_ranges;
+	idx_t current_row_range = 0;
 };
 
 struct ParquetColumnDefinition {
@@ -209,6 +221,13 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Probes the Bloom filter of the column chunk (if any), returns false if no value in the chunk can pass the filter
+	bool CheckBloomFilter(ParquetReaderScanState &state, ColumnReader &column_reader, const TableFilter &filter);
+	//! Uses the page index of the column chunk (if any) to restrict the row ranges of the row group that are scanned to
+	//! the pages that may contain rows that pass the filter, returns false if no rows are left
+	bool CheckPageIndex(ParquetReaderScanState &state, ColumnReader &column_reader, TableFilter &filter);
+	//! Sets the page locations of the scanned columns, so that the pages outside of the row ranges are skipped
+	void PreparePageSkipping(ParquetReaderScanState &state);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
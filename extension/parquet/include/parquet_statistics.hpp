@@ -10,6 +10,7 @@ namespace duckdb {
 
 using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::SchemaElement;
+using duckdb_parquet::format::Statistics;
 
 struct LogicalType;
 class ColumnReader;
@@ -18,6 +19,9 @@ struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
+	//! Transforms the statistics of a column chunk or page of a (non-nested) column
+	static unique_ptr<BaseStatistics> TransformStatistics(const LogicalType &type, const SchemaElement &schema_ele,
+	                                                      const Statistics &parquet_stats);
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
@@ -20,6 +20,7 @@
 #endif
 
 #include "column_writer.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_types.h"
 #include "geo_parquet.hpp"
 #include "thrift/protocol/TCompactProtocol.h"
@@ -38,6 +39,15 @@ struct PreparedRowGroup {
 	vector<shared_ptr<StringHeap>> heaps;
 };
 
+//! The page indexes and Bloom filter of a column chunk, which are written together after the last row group
+struct ParquetColumnChunkIndexes {
+	idx_t row_group_idx;
+	idx_t column_idx;
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index;
+	unique_ptr<ParquetBloomFilter> bloom_filter;
+};
+
 struct FieldID;
 struct ChildFieldIDs {
 	ChildFieldIDs();
@@ -67,7 +77,8 @@ public:
 	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level, bool debug_use_openssl);
+	              optional_idx compression_level, bool debug_use_openssl, case_insensitive_set_t bloom_filter_columns,
+	              bool write_page_index);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -103,6 +114,17 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	//! Whether or not Bloom filters are written for the (leaf) column with the given schema path
+	bool WriteBloomFilter(const vector<string> &schema_path) const {
+		return !schema_path.empty() && bloom_filter_columns.find(schema_path[0]) != bloom_filter_columns.end();
+	}
+	bool WritePageIndex() const {
+		return write_page_index;
+	}
+	//! Registers the page indexes and Bloom filter of a column chunk of the row group that is currently being flushed
+	void AddColumnChunkIndexes(idx_t column_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+	                           unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index,
+	                           unique_ptr<ParquetBloomFilter> bloom_filter);
 	idx_t NumberOfRowGroups() {
 		lock_guard<mutex> glock(lock);
 		return file_meta_data.row_groups.size();
@@ -116,6 +138,10 @@ public:
 	static bool TryGetParquetType(const LogicalType &duckdb_type,
 	                              optional_ptr<duckdb_parquet::format::Type::type> type = nullptr);
 
+private:
+	//! Writes the buffered page indexes and Bloom filters and sets their locations in the column chunks
+	void WriteColumnChunkIndexes();
+
 private:
 	string file_name;
 	vector<LogicalType> sql_types;
@@ -126,6 +152,8 @@ private:
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
 	bool debug_use_openssl;
+	case_insensitive_set_t bloom_filter_columns;
+	bool write_page_index;
 	shared_ptr<EncryptionUtil> encryption_util;
 
 	unique_ptr<BufferedFileWriter> writer;
@@ -134,6 +162,8 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	//! The page indexes and Bloom filters of the flushed column chunks
+	vector<ParquetColumnChunkIndexes> column_chunk_indexes;
 
 	unique_ptr<GeoParquetFileMetadata> geoparquet_data;
 };
@@ -7,8 +7,14 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
 #endif
 
+#include <condition_variable>
+
 namespace duckdb {
 
 // A ReadHead for prefetching data in a specific range
@@ -21,6 +27,12 @@ struct ReadHead {
 	// Current info
 	AllocatedData data;
 	bool data_isset = false;
+	// Whether the data is being fetched asynchronously (data_isset is then protected by the lock of the buffer)
+	bool fetching = false;
+	// The number of asynchronous requests for this read head that have not finished yet
+	idx_t pending_requests = 0;
+	// Whether any of the asynchronous requests for this read head failed
+	bool request_failed = false;
 
 	idx_t GetEnd() const {
 		return size + location;
@@ -31,28 +43,51 @@ struct ReadHead {
 	}
 };
 
-// Comparator for ReadHeads that are either overlapping, adjacent, or within ALLOW_GAP bytes from each other
+// Comparator for ReadHeads that are either overlapping, adjacent, or within allow_gap bytes from each other
 struct ReadHeadComparator {
 	static constexpr uint64_t ALLOW_GAP = 1 << 14; // 16 KiB
+
+	explicit ReadHeadComparator(uint64_t allow_gap = ALLOW_GAP) : allow_gap(allow_gap) {
+	}
+
+	uint64_t allow_gap;
+
 	bool operator()(const ReadHead *a, const ReadHead *b) const {
 		auto a_start = a->location;
 		auto a_end = a->location + a->size;
 		auto b_start = b->location;
 
-		if (a_end <= NumericLimits<idx_t>::Maximum() - ALLOW_GAP) {
-			a_end += ALLOW_GAP;
+		if (a_end <= NumericLimits<idx_t>::Maximum() - allow_gap) {
+			a_end += allow_gap;
 		}
 
 		return a_start < b_start && a_end < b_start;
 	}
 };
 
+// An asynchronous request that reads (part of) a read head
+struct ReadHeadRequest {
+	ReadHead *read_head;
+	idx_t offset;
+	idx_t size;
+};
+
 // Two-step read ahead buffer
 // 1: register all ranges that will be read, merging ranges that are consecutive
 // 2: prefetch all registered ranges
+// For remote files, the registered ranges are fetched concurrently by at most max_concurrent_requests threads, and
+// readers only wait for the range that they need
 struct ReadAheadBuffer {
-	ReadAheadBuffer(Allocator &allocator, FileHandle &handle) : allocator(allocator), handle(handle) {
+	static constexpr idx_t MAX_CONCURRENT_REQUESTS = 8;
+	// Large ranges are split into requests of at most this size, so that they are fetched concurrently as well
+	static constexpr idx_t MAX_REQUEST_SIZE = 1ULL << 23ULL; // 8 MiB
+
+	ReadAheadBuffer(Allocator &allocator, FileHandle &handle, uint64_t allow_gap = ReadHeadComparator::ALLOW_GAP,
+	                idx_t max_concurrent_requests = MAX_CONCURRENT_REQUESTS)
+	    : merge_set(ReadHeadComparator(allow_gap)), allocator(allocator), handle(handle),
+	      max_concurrent_requests(max_concurrent_requests) {
 	}
+	~ReadAheadBuffer();
 
 	// The list of read heads
 	std::list<ReadHead> read_heads;
@@ -104,26 +139,41 @@ struct ReadAheadBuffer {
 	}
 
 	// Prefetch all read heads
-	void Prefetch() {
-		for (auto &read_head : read_heads) {
-			read_head.Allocate(allocator);
+	void Prefetch();
+	// Makes sure the data of the read head is available, waiting for or issuing the read if required
+	void LoadReadHead(ReadHead &read_head);
+	// Waits for all asynchronous requests and removes all read heads
+	void Clear();
 
-			if (read_head.GetEnd() > handle.GetFileSize()) {
-				throw std::runtime_error("Prefetch registered requested for bytes outside file");
-			}
+private:
+	// Fetches the requests concurrently
+	void PrefetchAsync(vector<ReadHeadRequest> requests);
+	// Waits for the threads that fetch the read heads to finish
+	void JoinThreads();
 
-			handle.Read(read_head.data.get(), read_head.size, read_head.location);
-			read_head.data_isset = true;
-		}
-	}
+private:
+	idx_t max_concurrent_requests;
+	// Threads fetching the read heads
+	vector<thread> threads;
+	// The asynchronous requests, and the index of the next one that is to be issued
+	vector<ReadHeadRequest> requests;
+	atomic<idx_t> next_request {0};
+	// Lock and condition variable to wait for asynchronous requests
+	mutex lock;
+	std::condition_variable request_finished;
+	// The error thrown by any of the asynchronous requests
+	ErrorData error;
 };
 
 class ThriftFileTransport : public duckdb_apache::thrift::transport::TVirtualTransport<ThriftFileTransport> {
 public:
 	static constexpr uint64_t PREFETCH_FALLBACK_BUFFERSIZE = 1000000;
 
-	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p)
-	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(ReadAheadBuffer(allocator, handle_p)),
+	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p,
+	                    uint64_t prefetch_max_gap = ReadHeadComparator::ALLOW_GAP,
+	                    idx_t prefetch_max_concurrent_requests = ReadAheadBuffer::MAX_CONCURRENT_REQUESTS)
+	    : handle(handle_p), location(0), allocator(allocator),
+	      ra_buffer(allocator, handle_p, prefetch_max_gap, prefetch_max_concurrent_requests),
 	      prefetch_mode(prefetch_mode_p) {
 	}
 
@@ -132,16 +182,13 @@ public:
 		if (prefetch_buffer != nullptr && location - prefetch_buffer->location + len <= prefetch_buffer->size) {
 			D_ASSERT(location - prefetch_buffer->location + len <= prefetch_buffer->size);
 
-			if (!prefetch_buffer->data_isset) {
-				prefetch_buffer->Allocate(allocator);
-				handle.Read(prefetch_buffer->data.get(), prefetch_buffer->size, prefetch_buffer->location);
-				prefetch_buffer->data_isset = true;
-			}
+			ra_buffer.LoadReadHead(*prefetch_buffer);
 			memcpy(buf, prefetch_buffer->data.get() + location - prefetch_buffer->location, len);
 		} else {
 			if (prefetch_mode && len < PREFETCH_FALLBACK_BUFFERSIZE && len > 0) {
 				Prefetch(location, MinValue<uint64_t>(PREFETCH_FALLBACK_BUFFERSIZE, handle.GetFileSize() - location));
 				auto prefetch_buffer_fallback = ra_buffer.GetReadHead(location);
+				ra_buffer.LoadReadHead(*prefetch_buffer_fallback);
 				D_ASSERT(location - prefetch_buffer_fallback->location + len <= prefetch_buffer_fallback->size);
 				memcpy(buf, prefetch_buffer_fallback->data.get() + location - prefetch_buffer_fallback->location, len);
 			} else {
@@ -175,8 +222,7 @@ public:
 	}
 
 	void ClearPrefetch() {
-		ra_buffer.read_heads.clear();
-		ra_buffer.merge_set.clear();
+		ra_buffer.Clear();
 	}
 
 	void SetLocation(idx_t location_p) {
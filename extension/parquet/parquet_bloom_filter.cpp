@@ -0,0 +1,365 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "thrift/protocol/TProtocol.h"
+#include "zstd/common/xxhash.h"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
+#endif
+
+#include <cmath>
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TProtocol;
+using duckdb_apache::thrift::protocol::TType;
+using duckdb_parquet::format::Type;
+
+// the salt values used to derive the bit of each word from the hash, as defined by the specification
+static constexpr uint32_t BLOOM_FILTER_SALT[ParquetBloomFilter::WORDS_PER_BLOCK] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_bytes) : block_count(num_bytes / BYTES_PER_BLOCK) {
+	D_ASSERT(num_bytes % BYTES_PER_BLOCK == 0 && block_count > 0);
+	blocks = make_unsafe_uniq_array<uint32_t>(block_count * WORDS_PER_BLOCK);
+	memset(blocks.get(), 0, block_count * BYTES_PER_BLOCK);
+}
+
+//===--------------------------------------------------------------------===//
+// Header
+//===--------------------------------------------------------------------===//
+// The algorithm, hash and compression of the BloomFilterHeader are thrift unions of empty structs. Returns whether the
+// member with the given field id is set.
+static bool ReadUnionMember(TProtocol &protocol, int16_t expected_field_id) {
+	bool found = false;
+	std::string name;
+	TType field_type;
+	int16_t field_id;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == duckdb_apache::thrift::protocol::T_STOP) {
+			break;
+		}
+		if (field_id == expected_field_id && field_type == duckdb_apache::thrift::protocol::T_STRUCT) {
+			found = true;
+		}
+		protocol.skip(field_type);
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+	return found;
+}
+
+unique_ptr<ParquetBloomFilter> ParquetBloomFilter::Read(TProtocol &protocol) {
+	int32_t num_bytes = 0;
+	bool is_block = false;
+	bool is_xxhash = false;
+	bool is_uncompressed = false;
+
+	std::string name;
+	TType field_type;
+	int16_t field_id;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == duckdb_apache::thrift::protocol::T_STOP) {
+			break;
+		}
+		if (field_id == 1 && field_type == duckdb_apache::thrift::protocol::T_I32) {
+			protocol.readI32(num_bytes);
+		} else if (field_id == 2 && field_type == duckdb_apache::thrift::protocol::T_STRUCT) {
+			// BloomFilterAlgorithm: 1 = BLOCK
+			is_block = ReadUnionMember(protocol, 1);
+		} else if (field_id == 3 && field_type == duckdb_apache::thrift::protocol::T_STRUCT) {
+			// BloomFilterHash: 1 = XXHASH
+			is_xxhash = ReadUnionMember(protocol, 1);
+		} else if (field_id == 4 && field_type == duckdb_apache::thrift::protocol::T_STRUCT) {
+			// BloomFilterCompression: 1 = UNCOMPRESSED
+			is_uncompressed = ReadUnionMember(protocol, 1);
+		} else {
+			protocol.skip(field_type);
+		}
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+
+	if (!is_block || !is_xxhash || !is_uncompressed) {
+		return nullptr;
+	}
+	if (num_bytes <= 0 || idx_t(num_bytes) % BYTES_PER_BLOCK != 0 || idx_t(num_bytes) > MAX_FILTER_SIZE) {
+		return nullptr;
+	}
+	auto result = make_uniq<ParquetBloomFilter>(NumericCast<idx_t>(num_bytes));
+	protocol.getTransport()->read(reinterpret_cast<uint8_t *>(result->blocks.get()), NumericCast<uint32_t>(num_bytes));
+	return result;
+}
+
+static void WriteUnionMember(TProtocol &protocol, const char *union_name, const char *member_name,
+                             int16_t field_id) {
+	protocol.writeStructBegin(union_name);
+	protocol.writeFieldBegin(member_name, duckdb_apache::thrift::protocol::T_STRUCT, field_id);
+	protocol.writeStructBegin(member_name);
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+}
+
+void ParquetBloomFilter::Write(TProtocol &protocol) const {
+	protocol.writeStructBegin("BloomFilterHeader");
+	protocol.writeFieldBegin("numBytes", duckdb_apache::thrift::protocol::T_I32, 1);
+	protocol.writeI32(NumericCast<int32_t>(SizeInBytes()));
+	protocol.writeFieldEnd();
+	protocol.writeFieldBegin("algorithm", duckdb_apache::thrift::protocol::T_STRUCT, 2);
+	WriteUnionMember(protocol, "BloomFilterAlgorithm", "BLOCK", 1);
+	protocol.writeFieldEnd();
+	protocol.writeFieldBegin("hash", duckdb_apache::thrift::protocol::T_STRUCT, 3);
+	WriteUnionMember(protocol, "BloomFilterHash", "XXHASH", 1);
+	protocol.writeFieldEnd();
+	protocol.writeFieldBegin("compression", duckdb_apache::thrift::protocol::T_STRUCT, 4);
+	WriteUnionMember(protocol, "BloomFilterCompression", "UNCOMPRESSED", 1);
+	protocol.writeFieldEnd();
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+
+	protocol.getTransport()->write(reinterpret_cast<const uint8_t *>(blocks.get()),
+	                               NumericCast<uint32_t>(SizeInBytes()));
+}
+
+idx_t ParquetBloomFilter::OptimalNumBytes(idx_t distinct_values, double false_positive_ratio) {
+	D_ASSERT(false_positive_ratio > 0 && false_positive_ratio < 1);
+	// the optimal number of bits for a Bloom filter is -n * ln(p) / ln(2)^2
+	auto num_bits =
+	    -static_cast<double>(distinct_values) * std::log(false_positive_ratio) / (std::log(2.0) * std::log(2.0));
+	auto num_bytes = static_cast<idx_t>(std::ceil(num_bits / 8));
+	num_bytes = MinValue<idx_t>(NextPowerOfTwo(MaxValue<idx_t>(num_bytes, BYTES_PER_BLOCK)), MAX_WRITE_FILTER_SIZE);
+	return num_bytes;
+}
+
+//===--------------------------------------------------------------------===//
+// Hashing
+//===--------------------------------------------------------------------===//
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+template <class T>
+static uint64_t HashPlain(T value) {
+	data_t buffer[sizeof(T)];
+	Store<T>(value, buffer);
+	return ParquetBloomFilter::Hash(buffer, sizeof(T));
+}
+
+bool ParquetBloomFilter::HashValue(const Value &value, const LogicalType &type, const SchemaElement &schema,
+                                   uint64_t &result) {
+	if (value.IsNull() || value.type() != type || !schema.__isset.type) {
+		return false;
+	}
+	// only hash values whose plain encoding in the file follows directly from the column type
+	switch (schema.type) {
+	case Type::INT32:
+		switch (type.id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+			result = HashPlain<int32_t>(value.GetValue<int32_t>());
+			return true;
+		case LogicalTypeId::UINTEGER:
+			result = HashPlain<int32_t>(static_cast<int32_t>(value.GetValue<uint32_t>()));
+			return true;
+		case LogicalTypeId::DATE:
+			result = HashPlain<int32_t>(value.GetValue<date_t>().days);
+			return true;
+		default:
+			return false;
+		}
+	case Type::INT64:
+		switch (type.id()) {
+		case LogicalTypeId::BIGINT:
+			result = HashPlain<int64_t>(value.GetValue<int64_t>());
+			return true;
+		case LogicalTypeId::UBIGINT:
+			result = HashPlain<int64_t>(static_cast<int64_t>(value.GetValue<uint64_t>()));
+			return true;
+		default:
+			return false;
+		}
+	case Type::FLOAT: {
+		if (type.id() != LogicalTypeId::FLOAT) {
+			return false;
+		}
+		auto float_value = value.GetValue<float>();
+		// NaN and zero have several binary representations that compare as equal
+		if (Value::IsNan(float_value) || float_value == 0) {
+			return false;
+		}
+		result = HashPlain<float>(float_value);
+		return true;
+	}
+	case Type::DOUBLE: {
+		if (type.id() != LogicalTypeId::DOUBLE) {
+			return false;
+		}
+		auto double_value = value.GetValue<double>();
+		if (Value::IsNan(double_value) || double_value == 0) {
+			return false;
+		}
+		result = HashPlain<double>(double_value);
+		return true;
+	}
+	case Type::BYTE_ARRAY: {
+		if (type.id() != LogicalTypeId::VARCHAR && type.id() != LogicalTypeId::BLOB) {
+			return false;
+		}
+		auto &str = StringValue::Get(value);
+		result = Hash(const_data_ptr_cast(str.c_str()), str.size());
+		return true;
+	}
+	case Type::FIXED_LEN_BYTE_ARRAY: {
+		if (type.id() != LogicalTypeId::UUID || schema.type_length != sizeof(hugeint_t)) {
+			return false;
+		}
+		// UUIDs are stored as 16 big-endian bytes
+		auto uuid = value.GetValue<hugeint_t>();
+		uint64_t high_bytes = static_cast<uint64_t>(uuid.upper) ^ (uint64_t(1) << 63);
+		uint64_t low_bytes = uuid.lower;
+		data_t buffer[sizeof(hugeint_t)];
+		for (idx_t i = 0; i < sizeof(uint64_t); i++) {
+			auto shift_count = (sizeof(uint64_t) - i - 1) * 8;
+			buffer[i] = (high_bytes >> shift_count) & 0xFF;
+			buffer[sizeof(uint64_t) + i] = (low_bytes >> shift_count) & 0xFF;
+		}
+		result = Hash(buffer, sizeof(hugeint_t));
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Probing
+//===--------------------------------------------------------------------===//
+idx_t ParquetBloomFilter::GetBlockIndex(uint64_t hash) const {
+	// the upper 32 bits of the hash select the block
+	return static_cast<idx_t>(((hash >> 32) * block_count) >> 32);
+}
+
+void ParquetBloomFilter::ComputeMask(uint64_t hash, uint32_t mask[]) {
+	// the lower 32 bits of the hash select one bit in every word of the block
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		mask[i] = uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+void ParquetBloomFilter::InsertHash(uint64_t hash) {
+	uint32_t mask[WORDS_PER_BLOCK];
+	ComputeMask(hash, mask);
+	auto block = blocks.get() + GetBlockIndex(hash) * WORDS_PER_BLOCK;
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		block[i] |= mask[i];
+	}
+}
+
+bool ParquetBloomFilter::FindHash(uint64_t hash) const {
+	uint32_t mask[WORDS_PER_BLOCK];
+	ComputeMask(hash, mask);
+	auto block = blocks.get() + GetBlockIndex(hash) * WORDS_PER_BLOCK;
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		if ((block[i] & mask[i]) == 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ParquetBloomFilter::CheckFilter(const TableFilter &filter, const LogicalType &type,
+                                     const SchemaElement &schema) const {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		uint64_t hash;
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    !HashValue(constant_filter.constant, type, schema, hash)) {
+			return true;
+		}
+		return FindHash(hash);
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			uint64_t hash;
+			if (!HashValue(value, type, schema, hash) || FindHash(hash)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (!CheckFilter(*child_filter, type, schema)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (CheckFilter(*child_filter, type, schema)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::OPTIONAL_FILTER:
+		return CheckFilter(*filter.Cast<OptionalFilter>().child_filter, type, schema);
+	default:
+		return true;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Builder
+//===--------------------------------------------------------------------===//
+void ParquetBloomFilterBuilder::AddHash(uint64_t hash) {
+	if (filter) {
+		filter->InsertHash(hash);
+		return;
+	}
+	hashes.insert(hash);
+	if (hashes.size() > MAX_COLLECTED_HASHES) {
+		filter = make_uniq<ParquetBloomFilter>(ParquetBloomFilter::MAX_WRITE_FILTER_SIZE);
+		for (auto &collected_hash : hashes) {
+			filter->InsertHash(collected_hash);
+		}
+		hashes.clear();
+	}
+}
+
+unique_ptr<ParquetBloomFilter> ParquetBloomFilterBuilder::Finalize() {
+	if (filter) {
+		return std::move(filter);
+	}
+	if (hashes.empty()) {
+		return nullptr;
+	}
+	auto num_bytes =
+	    ParquetBloomFilter::OptimalNumBytes(hashes.size(), ParquetBloomFilter::DEFAULT_FALSE_POSITIVE_RATIO);
+	auto result = make_uniq<ParquetBloomFilter>(num_bytes);
+	for (auto &hash : hashes) {
+		result->InsertHash(hash);
+	}
+	hashes.clear();
+	return result;
+}
+
+} // namespace duckdb
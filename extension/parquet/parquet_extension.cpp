@@ -201,6 +201,11 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+
+	//! The (top-level) columns for which Bloom filters are written
+	vector<string> bloom_filter_columns;
+	//! Whether or not page indexes (ColumnIndex and OffsetIndex) are written
+	bool write_page_index = false;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -1277,10 +1282,32 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "bloom_filter_columns") {
+			auto &value = option.second[0];
+			vector<Value> columns;
+			if (value.type().id() == LogicalTypeId::LIST) {
+				columns = ListValue::GetChildren(value);
+			} else {
+				columns.push_back(value);
+			}
+			case_insensitive_set_t column_names(names.begin(), names.end());
+			for (auto &column : columns) {
+				auto column_name = column.ToString();
+				if (column_names.find(column_name) == column_names.end()) {
+					throw BinderException("Column \"%s\" referenced in BLOOM_FILTER_COLUMNS does not exist",
+					                      column_name);
+				}
+				bind_data->bloom_filter_columns.push_back(std::move(column_name));
+			}
+		} else if (loption == "write_page_index") {
+			bind_data->write_page_index = BooleanValue::Get(option.second[0].DefaultCastAs(LogicalType::BOOLEAN));
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (bind_data->encryption_config && (bind_data->write_page_index || !bind_data->bloom_filter_columns.empty())) {
+		throw BinderException("BLOOM_FILTER_COLUMNS and WRITE_PAGE_INDEX are not supported for encrypted files");
+	}
 	if (row_group_size_bytes_set) {
 		if (DBConfig::GetConfig(context).options.preserve_insertion_order) {
 			throw BinderException("ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use \"SET "
@@ -1306,7 +1333,10 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	    make_uniq<ParquetWriter>(context, fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                             parquet_bind.codec, parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata,
 	                             parquet_bind.encryption_config, parquet_bind.dictionary_compression_ratio_threshold,
-	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl);
+	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl,
+	                             case_insensitive_set_t(parquet_bind.bloom_filter_columns.begin(),
+	                                                    parquet_bind.bloom_filter_columns.end()),
+	                             parquet_bind.write_page_index);
 	return std::move(global_state);
 }
 
@@ -1430,6 +1460,8 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
 	serializer.WriteProperty(110, "row_groups_per_file", bind_data.row_groups_per_file);
 	serializer.WriteProperty(111, "debug_use_openssl", bind_data.debug_use_openssl);
+	serializer.WritePropertyWithDefault<vector<string>>(112, "bloom_filter_columns", bind_data.bloom_filter_columns);
+	serializer.WritePropertyWithDefault<bool>(113, "write_page_index", bind_data.write_page_index, false);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1449,6 +1481,8 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->row_groups_per_file =
 	    deserializer.ReadPropertyWithExplicitDefault<optional_idx>(110, "row_groups_per_file", optional_idx::Invalid());
 	data->debug_use_openssl = deserializer.ReadPropertyWithExplicitDefault<bool>(111, "debug_use_openssl", true);
+	deserializer.ReadPropertyWithDefault<vector<string>>(112, "bloom_filter_columns", data->bloom_filter_columns);
+	deserializer.ReadPropertyWithExplicitDefault<bool>(113, "write_page_index", data->write_page_index, false);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -1681,6 +1715,14 @@ void ParquetExtension::Load(DuckDB &db) {
 	config.replacement_scans.emplace_back(ParquetScanReplacement);
 	config.AddExtensionOption("binary_as_string", "In Parquet files, interpret binary data as a string.",
 	                          LogicalType::BOOLEAN);
+	config.AddExtensionOption("parquet_prefetch_max_gap",
+	                          "When prefetching remote Parquet files, ranges that are at most this many bytes apart are "
+	                          "fetched with a single request",
+	                          LogicalType::UBIGINT, Value::UBIGINT(ReadHeadComparator::ALLOW_GAP));
+	config.AddExtensionOption("parquet_prefetch_max_concurrent_requests",
+	                          "The maximum number of concurrent requests a Parquet reader issues when prefetching "
+	                          "remote files",
+	                          LogicalType::UBIGINT, Value::UBIGINT(ReadAheadBuffer::MAX_CONCURRENT_REQUESTS));
 }
 
 std::string ParquetExtension::Name() {
@@ -8,6 +8,7 @@
 #include "expression_column_reader.hpp"
 #include "geo_parquet.hpp"
 #include "list_column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_file_metadata_cache.hpp"
 #include "parquet_statistics.hpp"
@@ -26,8 +27,11 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -51,8 +55,11 @@ using duckdb_parquet::format::Statistics;
 using duckdb_parquet::format::Type;
 
 static unique_ptr<duckdb_apache::thrift::protocol::TProtocol>
-CreateThriftFileProtocol(Allocator &allocator, FileHandle &file_handle, bool prefetch_mode) {
-	auto transport = std::make_shared<ThriftFileTransport>(allocator, file_handle, prefetch_mode);
+CreateThriftFileProtocol(Allocator &allocator, FileHandle &file_handle, bool prefetch_mode,
+                         uint64_t prefetch_max_gap = ReadHeadComparator::ALLOW_GAP,
+                         idx_t prefetch_max_concurrent_requests = ReadAheadBuffer::MAX_CONCURRENT_REQUESTS) {
+	auto transport = std::make_shared<ThriftFileTransport>(allocator, file_handle, prefetch_mode, prefetch_max_gap,
+	                                                       prefetch_max_concurrent_requests);
 	return make_uniq<duckdb_apache::thrift::protocol::TCompactProtocolT<ThriftFileTransport>>(std::move(transport));
 }
 
@@ -717,6 +724,240 @@ static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, con
 	}
 }
 
+static FilterPropagateResult CheckParquetStatistics(BaseStatistics &stats, const LogicalType &type,
+                                                    const Statistics &pq_col_stats, TableFilter &filter) {
+	if (type.id() != LogicalTypeId::VARCHAR || !pq_col_stats.__isset.min_value || !pq_col_stats.__isset.max_value) {
+		return filter.CheckStatistics(stats);
+	}
+	// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
+	// however, when reading remote Parquet files, skipping row groups is really important
+	// here, we implement a special case to check the full length for string filters
+	if (filter.filter_type != TableFilterType::CONJUNCTION_AND) {
+		return CheckParquetStringFilter(stats, pq_col_stats, filter);
+	}
+	const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+	auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
+	for (auto &child_filter : and_filter.child_filters) {
+		auto child_prune_result = CheckParquetStringFilter(stats, pq_col_stats, *child_filter);
+		if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		} else if (child_prune_result != and_result) {
+			and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+	}
+	return and_result;
+}
+
+//! Whether the filter rejects all NULL values
+static bool FilterRejectsNulls(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IN_FILTER:
+	case TableFilterType::IS_NOT_NULL:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (FilterRejectsNulls(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!FilterRejectsNulls(*child_filter)) {
+				return false;
+			}
+		}
+		return !or_filter.child_filters.empty();
+	}
+	case TableFilterType::OPTIONAL_FILTER:
+		return FilterRejectsNulls(*filter.Cast<OptionalFilter>().child_filter);
+	default:
+		return false;
+	}
+}
+
+//! Intersects two lists of sorted, disjoint row ranges
+static vector<ParquetRowRange> IntersectRowRanges(const vector<ParquetRowRange> &left,
+                                                  const vector<ParquetRowRange> &right) {
+	vector<ParquetRowRange> result;
+	idx_t left_idx = 0;
+	idx_t right_idx = 0;
+	while (left_idx < left.size() && right_idx < right.size()) {
+		auto start = MaxValue<idx_t>(left[left_idx].start, right[right_idx].start);
+		auto end = MinValue<idx_t>(left[left_idx].end, right[right_idx].end);
+		if (start < end) {
+			result.push_back({start, end});
+		}
+		if (left[left_idx].end < right[right_idx].end) {
+			left_idx++;
+		} else {
+			right_idx++;
+		}
+	}
+	return result;
+}
+
+template <class T>
+static void ReadPageIndex(ParquetReaderScanState &state, ParquetReader &reader, int64_t offset, int32_t length,
+                          T &result) {
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	if (state.prefetch_mode && length > 0) {
+		transport.Prefetch(NumericCast<idx_t>(offset), NumericCast<idx_t>(length));
+	}
+	transport.SetLocation(NumericCast<idx_t>(offset));
+	reader.Read(result, *state.thrift_file_proto);
+}
+
+bool ParquetReader::CheckPageIndex(ParquetReaderScanState &state, ColumnReader &column_reader, TableFilter &filter) {
+	auto &schema = column_reader.Schema();
+	if (!schema.__isset.type || column_reader.MaxRepeat() > 0 || parquet_options.encryption_config) {
+		// only flat columns of unencrypted files have a page index that we can use directly
+		return true;
+	}
+	auto &group = GetGroup(state);
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+	if (state.group_offset >= group_rows) {
+		// the row group is skipped already
+		return true;
+	}
+	auto &column_chunk = group.columns[column_reader.FileIdx()];
+	if (!column_chunk.__isset.column_index_offset || !column_chunk.__isset.offset_index_offset) {
+		return true;
+	}
+	duckdb_parquet::format::ColumnIndex column_index;
+	duckdb_parquet::format::OffsetIndex offset_index;
+	ReadPageIndex(state, *this, column_chunk.column_index_offset, column_chunk.column_index_length, column_index);
+	ReadPageIndex(state, *this, column_chunk.offset_index_offset, column_chunk.offset_index_length, offset_index);
+
+	auto &pages = offset_index.page_locations;
+	auto page_count = pages.size();
+	if (page_count == 0 || column_index.null_pages.size() != page_count ||
+	    column_index.min_values.size() != page_count || column_index.max_values.size() != page_count) {
+		return true;
+	}
+	bool has_null_counts = column_index.__isset.null_counts && column_index.null_counts.size() == page_count;
+
+	vector<ParquetRowRange> ranges;
+	for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+		auto page_start = NumericCast<idx_t>(pages[page_idx].first_row_index);
+		auto page_end =
+		    page_idx + 1 < page_count ? NumericCast<idx_t>(pages[page_idx + 1].first_row_index) : group_rows;
+		if (page_start >= page_end || page_end > group_rows || (page_idx == 0 && page_start != 0)) {
+			// malformed offset index - ignore it
+			return true;
+		}
+		bool can_pass;
+		if (column_index.null_pages[page_idx]) {
+			can_pass = !FilterRejectsNulls(filter);
+		} else {
+			Statistics page_stats;
+			page_stats.__set_min_value(column_index.min_values[page_idx]);
+			page_stats.__set_max_value(column_index.max_values[page_idx]);
+			if (has_null_counts) {
+				page_stats.__set_null_count(column_index.null_counts[page_idx]);
+			}
+			auto stats = ParquetStatisticsUtils::TransformStatistics(column_reader.Type(), schema, page_stats);
+			can_pass = !stats || CheckParquetStatistics(*stats, column_reader.Type(), page_stats, filter) !=
+			                         FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+		if (!can_pass) {
+			continue;
+		}
+		if (!ranges.empty() && ranges.back().end == page_start) {
+			ranges.back().end = page_end;
+		} else {
+			ranges.push_back({page_start, page_end});
+		}
+	}
+
+	if (state.has_row_ranges) {
+		state.row_ranges = IntersectRowRanges(state.row_ranges, ranges);
+	} else {
+		state.row_ranges = std::move(ranges);
+		state.has_row_ranges = true;
+	}
+	return !state.row_ranges.empty();
+}
+
+void ParquetReader::PreparePageSkipping(ParquetReaderScanState &state) {
+	auto &group = GetGroup(state);
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+	if (!state.has_row_ranges || state.group_offset >= group_rows) {
+		return;
+	}
+	if (state.row_ranges.size() == 1 && state.row_ranges[0].start == 0 && state.row_ranges[0].end == group_rows) {
+		// all pages may contain matching rows
+		state.has_row_ranges = false;
+		state.row_ranges.clear();
+		return;
+	}
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto &column_reader = *root_reader.GetChildReader(reader_data.column_ids[col_idx]);
+		if (!column_reader.Schema().__isset.type || column_reader.MaxRepeat() > 0) {
+			continue;
+		}
+		auto &column_chunk = group.columns[column_reader.FileIdx()];
+		if (!column_chunk.__isset.offset_index_offset) {
+			continue;
+		}
+		duckdb_parquet::format::OffsetIndex offset_index;
+		ReadPageIndex(state, *this, column_chunk.offset_index_offset, column_chunk.offset_index_length, offset_index);
+		column_reader.SetPageLocations(std::move(offset_index.page_locations));
+	}
+}
+
+bool ParquetReader::CheckBloomFilter(ParquetReaderScanState &state, ColumnReader &column_reader,
+                                     const TableFilter &filter) {
+	auto &schema = column_reader.Schema();
+	if (!schema.__isset.type || column_reader.MaxRepeat() > 0 || parquet_options.encryption_config) {
+		// only flat columns of unencrypted files have Bloom filters that we can probe directly
+		return true;
+	}
+	auto &group = GetGroup(state);
+	if (state.group_offset >= NumericCast<idx_t>(group.num_rows)) {
+		// the row group is skipped already
+		return true;
+	}
+	auto &column_chunk = group.columns[column_reader.FileIdx()];
+	if (!column_chunk.__isset.meta_data || !column_chunk.meta_data.__isset.bloom_filter_offset) {
+		return true;
+	}
+	// only load the filter if it could rule out the filter constants
+	uint64_t hash;
+	bool can_prune = false;
+	if (filter.filter_type == TableFilterType::CONSTANT_COMPARISON) {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		can_prune = constant_filter.comparison_type == ExpressionType::COMPARE_EQUAL &&
+		            ParquetBloomFilter::HashValue(constant_filter.constant, column_reader.Type(), schema, hash);
+	} else {
+		can_prune = filter.filter_type == TableFilterType::IN_FILTER ||
+		            filter.filter_type == TableFilterType::CONJUNCTION_AND ||
+		            filter.filter_type == TableFilterType::CONJUNCTION_OR ||
+		            filter.filter_type == TableFilterType::OPTIONAL_FILTER;
+	}
+	if (!can_prune) {
+		return true;
+	}
+
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	auto bloom_filter_offset = NumericCast<idx_t>(column_chunk.meta_data.bloom_filter_offset);
+	if (state.prefetch_mode && column_chunk.meta_data.__isset.bloom_filter_length) {
+		// fetch the header and the bitset in a single request
+		transport.Prefetch(bloom_filter_offset, NumericCast<idx_t>(column_chunk.meta_data.bloom_filter_length));
+	}
+	transport.SetLocation(bloom_filter_offset);
+	auto bloom_filter = ParquetBloomFilter::Read(*state.thrift_file_proto);
+	if (!bloom_filter) {
+		return true;
+	}
+	return bloom_filter->CheckFilter(filter, column_reader.Type(), schema);
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
 	auto &group = GetGroup(state);
 	auto column_id = reader_data.column_ids[col_idx];
@@ -733,34 +974,14 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 			auto &filter = *filter_entry->second;
 
 			FilterPropagateResult prune_result;
-			if (column_reader->Type().id() == LogicalTypeId::VARCHAR &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.min_value &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.max_value) {
-				// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
-				// however, when reading remote Parquet files, skipping row groups is really important
-				// here, we implement a special case to check the full length for string filters
-				if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
-					const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
-					auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
-					for (auto &child_filter : and_filter.child_filters) {
-						auto child_prune_result = CheckParquetStringFilter(
-						    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, *child_filter);
-						if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-							and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
-							break;
-						} else if (child_prune_result != and_result) {
-							and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
-						}
-					}
-					prune_result = and_result;
-				} else {
-					prune_result = CheckParquetStringFilter(
-					    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, filter);
-				}
+			if (column_reader->Type().id() == LogicalTypeId::VARCHAR) {
+				prune_result = CheckParquetStatistics(*stats, column_reader->Type(),
+				                                      group.columns[column_reader->FileIdx()].meta_data.statistics,
+				                                      filter);
 			} else {
+				// nested columns (e.g. structs) have no column chunk of their own
 				prune_result = filter.CheckStatistics(*stats);
 			}
-
 			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 				skip_chunk = true;
 			}
@@ -770,6 +991,18 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 				return;
 			}
 		}
+		if (filter_entry != reader_data.filters->filters.end() &&
+		    !CheckBloomFilter(state, *column_reader, *filter_entry->second)) {
+			// the Bloom filter of the column chunk rules out all the values we are looking for
+			state.group_offset = group.num_rows;
+			return;
+		}
+		if (stats && filter_entry != reader_data.filters->filters.end() &&
+		    !CheckPageIndex(state, *column_reader, *filter_entry->second)) {
+			// the page index shows that no page of the column chunk contains values that pass the filter
+			state.group_offset = group.num_rows;
+			return;
+		}
 	}
 
 	state.root_reader->InitializeRead(state.group_idx_list[state.current_group], group.columns,
@@ -804,7 +1037,19 @@ void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanStat
 		state.file_handle = fs.OpenFile(file_handle->path, flags);
 	}
 
-	state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode);
+	// ranges that are at most prefetch_max_gap bytes apart are fetched with a single request
+	uint64_t prefetch_max_gap = ReadHeadComparator::ALLOW_GAP;
+	idx_t prefetch_max_concurrent_requests = ReadAheadBuffer::MAX_CONCURRENT_REQUESTS;
+	Value setting_value;
+	if (context.TryGetCurrentSetting("parquet_prefetch_max_gap", setting_value) && !setting_value.IsNull()) {
+		prefetch_max_gap = setting_value.GetValue<uint64_t>();
+	}
+	if (context.TryGetCurrentSetting("parquet_prefetch_max_concurrent_requests", setting_value) &&
+	    !setting_value.IsNull()) {
+		prefetch_max_concurrent_requests = setting_value.GetValue<uint64_t>();
+	}
+	state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode,
+	                                                   prefetch_max_gap, prefetch_max_concurrent_requests);
 	state.root_reader = CreateReader(context);
 	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
@@ -852,6 +1097,46 @@ void FilterIsNotNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
 	}
 }
 
+void FilterBloom(Vector &v, const BloomFilter &bloom_filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (v.GetType() != bloom_filter.key_type) {
+		// hashes are only comparable for the same type - the filter can not remove anything
+		return;
+	}
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+
+	Vector hashes(LogicalType::HASH, count);
+	VectorOperations::Hash(v, hashes, count);
+	hashes.Flatten(count);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			auto is_valid = vdata.validity.RowIsValid(vdata.sel->get_index(i));
+			filter_mask.set(i, is_valid && bloom_filter.Contains(hash_data[i]));
+		}
+	}
+}
+
+void FilterIn(Vector &v, const InFilter &in_filter, parquet_filter_t &filter_mask, idx_t count) {
+	SelectionVector sel(count);
+	idx_t approved_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(approved_count++, i);
+		}
+	}
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	SelectionVector result_sel(approved_count);
+	auto result_count = in_filter.Select(v, vdata, sel, approved_count, result_sel);
+	for (idx_t i = 0; i < approved_count; i++) {
+		filter_mask.set(sel.get_index(i), false);
+	}
+	for (idx_t i = 0; i < result_count; i++) {
+		filter_mask.set(result_sel.get_index(i), true);
+	}
+}
+
 template <class T, class OP>
 void TemplatedFilterOperation(Vector &v, T constant, parquet_filter_t &filter_mask, idx_t count) {
 	if (v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
@@ -994,6 +1279,15 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::BLOOM_FILTER:
+		FilterBloom(v, filter.Cast<BloomFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::IN_FILTER:
+		FilterIn(v, filter.Cast<InFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::OPTIONAL_FILTER:
+		ApplyFilter(v, *filter.Cast<OptionalFilter>().child_filter, filter_mask, count);
+		break;
 	default:
 		D_ASSERT(0);
 		break;
@@ -1022,6 +1316,9 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
 		trans.ClearPrefetch();
 		state.current_group_prefetched = false;
+		state.has_row_ranges = false;
+		state.row_ranges.clear();
+		state.current_row_range = 0;
 
 		if ((idx_t)state.current_group == state.group_idx_list.size()) {
 			state.finished = true;
@@ -1037,6 +1334,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
+		PreparePageSkipping(state);
 
 		auto &group = GetGroup(state);
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
@@ -1088,7 +1386,30 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
-	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	auto group_rows = NumericCast<idx_t>(GetGroup(state).num_rows);
+	auto group_end = group_rows;
+	if (state.has_row_ranges) {
+		// skip the pages that cannot contain rows that pass the filters
+		while (state.current_row_range < state.row_ranges.size() &&
+		       state.row_ranges[state.current_row_range].end <= state.group_offset) {
+			state.current_row_range++;
+		}
+		if (state.current_row_range == state.row_ranges.size()) {
+			state.group_offset = group_rows;
+			return true;
+		}
+		auto &row_range = state.row_ranges[state.current_row_range];
+		if (row_range.start > state.group_offset) {
+			auto skip_count = row_range.start - state.group_offset;
+			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+			for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+				root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_count);
+			}
+			state.group_offset = row_range.start;
+		}
+		group_end = row_range.end;
+	}
+	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, group_end - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
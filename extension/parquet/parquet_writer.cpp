@@ -25,12 +25,14 @@ using namespace duckdb_apache::thrift;            // NOLINT
 using namespace duckdb_apache::thrift::protocol;  // NOLINT
 using namespace duckdb_apache::thrift::transport; // NOLINT
 
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::Encoding;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileCryptoMetaData;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
 using duckdb_parquet::format::PageType;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
@@ -319,11 +321,13 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
                              double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
-                             bool debug_use_openssl_p)
+                             bool debug_use_openssl_p, case_insensitive_set_t bloom_filter_columns_p,
+                             bool write_page_index_p)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
       field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
       dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
-      debug_use_openssl(debug_use_openssl_p) {
+      debug_use_openssl(debug_use_openssl_p), bloom_filter_columns(std::move(bloom_filter_columns_p)),
+      write_page_index(write_page_index_p) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -522,6 +526,54 @@ void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
 	prepared.heaps.clear();
 }
 
+void ParquetWriter::AddColumnChunkIndexes(idx_t column_idx, unique_ptr<ColumnIndex> column_index,
+                                          unique_ptr<OffsetIndex> offset_index,
+                                          unique_ptr<ParquetBloomFilter> bloom_filter) {
+	// this is called while the row group is flushed (with the lock held), before it is added to the file meta data
+	ParquetColumnChunkIndexes indexes;
+	indexes.row_group_idx = file_meta_data.row_groups.size();
+	indexes.column_idx = column_idx;
+	indexes.column_index = std::move(column_index);
+	indexes.offset_index = std::move(offset_index);
+	indexes.bloom_filter = std::move(bloom_filter);
+	column_chunk_indexes.push_back(std::move(indexes));
+}
+
+void ParquetWriter::WriteColumnChunkIndexes() {
+	// Bloom filters are written first, followed by all column indexes and then all offset indexes
+	for (auto &indexes : column_chunk_indexes) {
+		if (!indexes.bloom_filter) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[indexes.row_group_idx].columns[indexes.column_idx];
+		auto offset = writer->GetTotalWritten();
+		indexes.bloom_filter->Write(*protocol);
+		column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(offset));
+		column_chunk.meta_data.__set_bloom_filter_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	for (auto &indexes : column_chunk_indexes) {
+		if (!indexes.column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[indexes.row_group_idx].columns[indexes.column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(*indexes.column_index);
+		column_chunk.__set_column_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_column_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	for (auto &indexes : column_chunk_indexes) {
+		if (!indexes.offset_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[indexes.row_group_idx].columns[indexes.column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(*indexes.offset_index);
+		column_chunk.__set_offset_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_offset_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	column_chunk_indexes.clear();
+}
+
 void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	if (buffer.Count() == 0) {
 		return;
@@ -535,6 +587,8 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 }
 
 void ParquetWriter::Finalize() {
+	WriteColumnChunkIndexes();
+
 	const auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
@@ -0,0 +1,121 @@
+#include "thrift_tools.hpp"
+
+namespace duckdb {
+
+ReadAheadBuffer::~ReadAheadBuffer() {
+	JoinThreads();
+}
+
+void ReadAheadBuffer::Prefetch() {
+	// wait for earlier asynchronous requests, so that their state can be reused
+	JoinThreads();
+
+	vector<ReadHeadRequest> new_requests;
+	for (auto &read_head : read_heads) {
+		if (read_head.data_isset || read_head.fetching) {
+			continue;
+		}
+		if (read_head.GetEnd() > handle.GetFileSize()) {
+			throw std::runtime_error("Prefetch registered requested for bytes outside file");
+		}
+		read_head.Allocate(allocator);
+		for (idx_t offset = 0; offset < read_head.size; offset += MAX_REQUEST_SIZE) {
+			new_requests.push_back({&read_head, offset, MinValue<idx_t>(MAX_REQUEST_SIZE, read_head.size - offset)});
+		}
+	}
+#ifndef DUCKDB_NO_THREADS
+	if (new_requests.size() > 1 && max_concurrent_requests > 1 && !handle.OnDiskFile()) {
+		// every request is a round trip to a remote server: issue them concurrently
+		PrefetchAsync(std::move(new_requests));
+		return;
+	}
+#endif
+	for (auto &request : new_requests) {
+		auto &read_head = *request.read_head;
+		handle.Read(read_head.data.get() + request.offset, request.size, read_head.location + request.offset);
+		read_head.data_isset = true;
+	}
+}
+
+void ReadAheadBuffer::PrefetchAsync(vector<ReadHeadRequest> new_requests) {
+	D_ASSERT(threads.empty());
+	requests = std::move(new_requests);
+	next_request = 0;
+	for (auto &request : requests) {
+		request.read_head->fetching = true;
+		request.read_head->pending_requests++;
+	}
+	auto thread_count = MinValue<idx_t>(max_concurrent_requests, requests.size());
+	for (idx_t i = 0; i < thread_count; i++) {
+		threads.emplace_back([&]() {
+			while (true) {
+				auto request_idx = next_request++;
+				if (request_idx >= requests.size()) {
+					return;
+				}
+				auto &request = requests[request_idx];
+				auto &read_head = *request.read_head;
+				ErrorData request_error;
+				try {
+					handle.Read(read_head.data.get() + request.offset, request.size,
+					            read_head.location + request.offset);
+				} catch (std::exception &ex) {
+					request_error = ErrorData(ex);
+				}
+				lock_guard<mutex> guard(lock);
+				if (request_error.HasError()) {
+					read_head.request_failed = true;
+					if (!error.HasError()) {
+						error = std::move(request_error);
+					}
+				} else if (--read_head.pending_requests == 0) {
+					read_head.data_isset = true;
+				}
+				request_finished.notify_all();
+			}
+		});
+	}
+}
+
+void ReadAheadBuffer::LoadReadHead(ReadHead &read_head) {
+	if (read_head.fetching) {
+		// wait only for the requests of this read head - the other ones keep running in the background
+		std::unique_lock<mutex> guard(lock);
+		request_finished.wait(guard, [&]() { return read_head.data_isset || read_head.request_failed; });
+		if (read_head.request_failed) {
+			error.Throw();
+		}
+		return;
+	}
+	if (!read_head.data_isset) {
+		read_head.Allocate(allocator);
+		handle.Read(read_head.data.get(), read_head.size, read_head.location);
+		read_head.data_isset = true;
+	}
+}
+
+void ReadAheadBuffer::JoinThreads() {
+	for (auto &worker : threads) {
+		worker.join();
+	}
+	threads.clear();
+	requests.clear();
+	for (auto &read_head : read_heads) {
+		read_head.fetching = false;
+		if (read_head.request_failed) {
+			// the read head is read again (synchronously) if it is needed after all
+			read_head.request_failed = false;
+			read_head.pending_requests = 0;
+		}
+	}
+	error = ErrorData();
+}
+
+void ReadAheadBuffer::Clear() {
+	JoinThreads();
+	read_heads.clear();
+	merge_set.clear();
+	total_size = 0;
+}
+
+} // namespace duckdb
@@ -23,6 +23,7 @@ metrics = [
     "OPERATOR_ROWS_SCANNED",
     "OPERATOR_TIMING",
     "RESULT_SET_SIZE",
+    "SCHEDULER_WAIT_TIME",
 ]
 
 phase_timing_metrics = [
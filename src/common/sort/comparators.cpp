@@ -67,6 +67,29 @@ int Comparators::CompareVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, cons
 	}
 }
 
+int Comparators::CompareTiedVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, const LogicalType &type,
+                                const idx_t &prefix_len) {
+	if (type.InternalType() != PhysicalType::VARCHAR) {
+		return CompareVal(l_ptr, r_ptr, type);
+	}
+	// The bytes of the strings that are in the sort key are equal, only compare what comes after them
+	const auto left_val = Load<string_t>(l_ptr);
+	const auto right_val = Load<string_t>(r_ptr);
+	const auto left_size = left_val.GetSize();
+	const auto right_size = right_val.GetSize();
+	const auto min_size = MinValue(left_size, right_size);
+	const auto skip = MinValue<idx_t>(prefix_len, min_size);
+	auto memcmp_res =
+	    memcmp(left_val.GetData() + skip, right_val.GetData() + skip, NumericCast<size_t>(min_size - skip));
+	if (memcmp_res != 0) {
+		return memcmp_res < 0 ? -1 : 1;
+	}
+	if (left_size == right_size) {
+		return 0;
+	}
+	return left_size < right_size ? -1 : 1;
+}
+
 int Comparators::BreakBlobTie(const idx_t &tie_col, const SBScanState &left, const SBScanState &right,
                               const SortLayout &sort_layout, const bool &external) {
 	data_ptr_t l_data_ptr = left.DataPtr(*left.sb->blob_sorting_data);
@@ -92,12 +115,12 @@ int Comparators::BreakBlobTie(const idx_t &tie_col, const SBScanState &left, con
 		UnswizzleSingleValue(l_data_ptr, l_heap_ptr, type);
 		UnswizzleSingleValue(r_data_ptr, r_heap_ptr, type);
 		// Compare
-		result = CompareVal(l_data_ptr, r_data_ptr, type);
+		result = CompareTiedVal(l_data_ptr, r_data_ptr, type, sort_layout.prefix_lengths[tie_col]);
 		// Swizzle the pointers back to offsets
 		SwizzleSingleValue(l_data_ptr, l_heap_ptr, type);
 		SwizzleSingleValue(r_data_ptr, r_heap_ptr, type);
 	} else {
-		result = CompareVal(l_data_ptr, r_data_ptr, type);
+		result = CompareTiedVal(l_data_ptr, r_data_ptr, type, sort_layout.prefix_lengths[tie_col]);
 	}
 	return order * result;
 }
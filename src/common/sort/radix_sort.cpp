@@ -28,14 +28,15 @@ static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t datapt
 	const idx_t &col_idx = sort_layout.sorting_to_blob_col.at(tie_col);
 	const auto &tie_col_offset = sort_layout.blob_layout.GetOffsets()[col_idx];
 	auto logical_type = sort_layout.blob_layout.GetTypes()[col_idx];
+	const auto &prefix_len = sort_layout.prefix_lengths[tie_col];
 	std::sort(entry_ptrs, entry_ptrs + end - start,
-	          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width, &logical_type](const data_ptr_t l,
-	                                                                                        const data_ptr_t r) {
+	          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width, &logical_type,
+	           &prefix_len](const data_ptr_t l, const data_ptr_t r) {
 		          idx_t left_idx = Load<uint32_t>(l + sort_layout.comparison_size);
 		          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
 		          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
 		          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
-		          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
+		          return order * Comparators::CompareTiedVal(left_ptr, right_ptr, logical_type, prefix_len) < 0;
 	          });
 	// Re-order
 	auto temp_block = buffer_manager.GetBufferAllocator().Allocate((end - start) * sort_layout.entry_size);
@@ -54,7 +55,7 @@ static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t datapt
 			// Load next entry and compare
 			idx_ptr += sort_layout.entry_size;
 			data_ptr_t next_ptr = blob_ptr + Load<uint32_t>(idx_ptr) * row_width + tie_col_offset;
-			ties[start + i] = Comparators::CompareVal(current_ptr, next_ptr, logical_type) == 0;
+			ties[start + i] = Comparators::CompareTiedVal(current_ptr, next_ptr, logical_type, prefix_len) == 0;
 			current_ptr = next_ptr;
 		}
 	}
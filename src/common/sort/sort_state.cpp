@@ -3,6 +3,7 @@
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/sort/sorted_block.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 
 #include <algorithm>
@@ -70,15 +71,13 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 			prefix_lengths.back() = GetNestedSortingColSize(col_size, expr.return_type);
 		} else if (physical_type == PhysicalType::VARCHAR) {
 			idx_t size_before = col_size;
-			if (stats.back() && StringStats::HasMaxStringLength(*stats.back())) {
+			if (stats.back() && StringStats::HasMaxStringLength(*stats.back()) &&
+			    StringStats::MaxStringLength(*stats.back()) <= SortConstants::MAX_NORMALIZED_STRING_LENGTH) {
+				// The full string fits in the sort key - ties never have to be broken using the heap
 				col_size += StringStats::MaxStringLength(*stats.back());
-				if (col_size > 12) {
-					col_size = 12;
-				} else {
-					constant_size.back() = true;
-				}
+				constant_size.back() = true;
 			} else {
-				col_size = 12;
+				col_size = SortConstants::STRING_PREFIX_LENGTH;
 			}
 			prefix_lengths.back() = col_size - size_before;
 		} else {
@@ -366,7 +365,8 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), merge_fan_in(SortConstants::MAX_MERGE_FAN_IN), group_idx(0), num_groups(0),
+      partition_idx(0) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -423,6 +423,22 @@ void GlobalSortState::PrepareMergePhase() {
 			block_capacity = MaxValue(block_capacity, sb->Count());
 		}
 	}
+	// Determine how many blocks we can merge at once
+	// Each thread keeps the current blocks of all blocks that it is merging pinned, and writes a merged block of
+	// the same size, so we bound the fan-in by the available memory (also when the data fits in memory)
+	const auto block_size = buffer_manager.GetBlockSize();
+	idx_t run_size = block_capacity * (sort_layout.entry_size + payload_layout.GetRowWidth());
+	if (!sort_layout.all_constant) {
+		run_size += block_capacity * sort_layout.blob_layout.GetRowWidth() + block_size;
+	}
+	if (!payload_layout.AllConstant()) {
+		run_size += block_size;
+	}
+	const auto num_threads =
+	    NumericCast<idx_t>(TaskScheduler::GetScheduler(buffer_manager.GetDatabase()).NumberOfThreads());
+	const auto max_fan_in = buffer_manager.GetQueryMaxMemory() / 2 / MaxValue<idx_t>(num_threads * run_size, 1);
+	// We always need to be able to merge at least two blocks
+	merge_fan_in = MaxValue<idx_t>(MinValue<idx_t>(SortConstants::MAX_MERGE_FAN_IN, max_fan_in), 2);
 	// Unswizzle and pin heap blocks if we can fit everything in memory
 	if (!external) {
 		for (auto &sb : sorted_blocks) {
@@ -437,18 +453,18 @@ void GlobalSortState::InitializeMergeRound() {
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
-	// Uneven number of blocks - keep one on the side
-	if (sorted_blocks.size() % 2 == 1) {
+	// The last group would consist of a single block - keep it on the side
+	if (sorted_blocks.size() % merge_fan_in == 1) {
 		odd_one_out = std::move(sorted_blocks.back());
 		sorted_blocks.pop_back();
 	}
 	// Init merge path path indices
-	pair_idx = 0;
-	num_pairs = sorted_blocks.size() / 2;
-	l_start = 0;
-	r_start = 0;
+	group_idx = 0;
+	num_groups = (sorted_blocks.size() + merge_fan_in - 1) / merge_fan_in;
+	partition_idx = 0;
+	merge_starts.assign(MinValue(merge_fan_in, sorted_blocks.size()), 0);
 	// Allocate room for merge results
-	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
+	for (idx_t g_idx = 0; g_idx < num_groups; g_idx++) {
 		sorted_blocks_temp.emplace_back();
 	}
 }
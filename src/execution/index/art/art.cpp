@@ -13,10 +13,11 @@
 #include "duckdb/execution/index/art/node256_leaf.hpp"
 #include "duckdb/execution/index/art/node48.hpp"
 #include "duckdb/execution/index/art/prefix.hpp"
-#include "duckdb/optimizer/matcher/expression_matcher.hpp"
 #include "duckdb/planner/expression/bound_between_expression.hpp"
 #include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -33,6 +34,16 @@ struct ARTIndexScanState : public IndexScanState {
 	bool checked = false;
 	//! All scanned row IDs.
 	unsafe_vector<row_t> row_ids;
+
+	//! True, if we scan the equality prefixes instead of the predicates above.
+	bool prefix_scan = false;
+	//! The values of the leading index columns, one entry per point lookup or prefix scan.
+	vector<vector<Value>> prefixes;
+	//! The range predicates on the index column following the prefixes, if any.
+	Value low_value;
+	ExpressionType low_expression = ExpressionType::INVALID;
+	Value high_value;
+	ExpressionType high_expression = ExpressionType::INVALID;
 };
 
 //===--------------------------------------------------------------------===//
@@ -132,91 +143,314 @@ static unique_ptr<IndexScanState> InitializeScanTwoPredicates(const Value &low_v
 	return std::move(result);
 }
 
-unique_ptr<IndexScanState> ART::TryInitializeScan(const Expression &expr, const Expression &filter_expr) {
-	Value low_value, high_value, equal_value;
-	ExpressionType low_comparison_type = ExpressionType::INVALID, high_comparison_type = ExpressionType::INVALID;
-
-	// Try to find a matching index for any of the filter expressions.
-	ComparisonExpressionMatcher matcher;
-	// Match on a comparison type.
-	matcher.expr_type = make_uniq<ComparisonExpressionTypeMatcher>();
-	// Match on a constant comparison with the indexed expression.
-	matcher.matchers.push_back(make_uniq<ExpressionEqualityMatcher>(expr));
-	matcher.matchers.push_back(make_uniq<ConstantExpressionMatcher>());
-	matcher.policy = SetMatcher::Policy::UNORDERED;
-
-	vector<reference<Expression>> bindings;
-	auto filter_match =
-	    matcher.Match(const_cast<Expression &>(filter_expr), bindings); // NOLINT: Match does not alter the expr.
-	if (filter_match) {
-		// This is a range or equality comparison with a constant value, so we can use the index.
-		// 		bindings[0] = the expression
-		// 		bindings[1] = the index expression
-		// 		bindings[2] = the constant
-		auto &comparison = bindings[0].get().Cast<BoundComparisonExpression>();
-		auto constant_value = bindings[2].get().Cast<BoundConstantExpression>().value;
-		auto comparison_type = comparison.type;
-
-		if (comparison.left->type == ExpressionType::VALUE_CONSTANT) {
-			// The expression is on the right side, we flip the comparison expression.
-			comparison_type = FlipComparisonExpression(comparison_type);
+//! The predicates of a filter on a single index column.
+struct ARTColumnPredicates {
+	//! The equality value, or the values of an IN list or OR-equalities.
+	bool has_equal = false;
+	vector<Value> equal_values;
+	Value low_value;
+	ExpressionType low_expression = ExpressionType::INVALID;
+	Value high_value;
+	ExpressionType high_expression = ExpressionType::INVALID;
+};
+
+//! The maximum number of point lookups or prefix scans of a single index scan.
+static constexpr idx_t MAX_INDEX_SCAN_PREFIXES = STANDARD_VECTOR_SIZE;
+
+static optional_idx FindIndexColumn(const vector<unique_ptr<Expression>> &index_expressions, const Expression &expr) {
+	for (idx_t i = 0; i < index_expressions.size(); i++) {
+		if (index_expressions[i]->Equals(expr)) {
+			return i;
 		}
+	}
+	return optional_idx();
+}
 
-		if (comparison_type == ExpressionType::COMPARE_EQUAL) {
-			// An equality value overrides any other bounds.
-			equal_value = constant_value;
-		} else if (comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
-		           comparison_type == ExpressionType::COMPARE_GREATERTHAN) {
-			// This is a lower bound.
-			low_value = constant_value;
-			low_comparison_type = comparison_type;
-		} else {
-			// This is an upper bound.
-			high_value = constant_value;
-			high_comparison_type = comparison_type;
+static bool IsUsableConstant(const ART &art, const idx_t column, const Expression &expr) {
+	if (expr.type != ExpressionType::VALUE_CONSTANT) {
+		return false;
+	}
+	auto &value = expr.Cast<BoundConstantExpression>().value;
+	return !value.IsNull() && value.type().InternalType() == art.types[column];
+}
+
+//! Matches a comparison between an index column and a constant, e.g., i = 42 or 42 > i.
+static bool MatchComparison(const ART &art, const vector<unique_ptr<Expression>> &index_expressions,
+                            const Expression &filter, idx_t &column, ExpressionType &comparison_type, Value &value) {
+	if (filter.GetExpressionClass() != ExpressionClass::BOUND_COMPARISON) {
+		return false;
+	}
+	auto &comparison = filter.Cast<BoundComparisonExpression>();
+	comparison_type = comparison.type;
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+	case ExpressionType::COMPARE_LESSTHAN:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		break;
+	default:
+		return false;
+	}
+
+	auto index_column = FindIndexColumn(index_expressions, *comparison.left);
+	auto constant = comparison.right.get();
+	if (!index_column.IsValid()) {
+		// The expression is on the right side, we flip the comparison expression.
+		index_column = FindIndexColumn(index_expressions, *comparison.right);
+		constant = comparison.left.get();
+		comparison_type = FlipComparisonExpression(comparison_type);
+	}
+	if (!index_column.IsValid() || !IsUsableConstant(art, index_column.GetIndex(), *constant)) {
+		return false;
+	}
+	column = index_column.GetIndex();
+	value = constant->Cast<BoundConstantExpression>().value;
+	return true;
+}
+
+//! Matches a conjunction of equalities between index columns and constants.
+static bool MatchEqualities(const ART &art, const vector<unique_ptr<Expression>> &index_expressions,
+                            const Expression &filter, vector<Value> &values) {
+	if (filter.type == ExpressionType::CONJUNCTION_AND) {
+		auto &conjunction = filter.Cast<BoundConjunctionExpression>();
+		for (auto &child : conjunction.children) {
+			if (!MatchEqualities(art, index_expressions, *child, values)) {
+				return false;
+			}
 		}
+		return true;
+	}
+	idx_t column;
+	ExpressionType comparison_type;
+	Value value;
+	if (!MatchComparison(art, index_expressions, filter, column, comparison_type, value) ||
+	    comparison_type != ExpressionType::COMPARE_EQUAL) {
+		return false;
+	}
+	if (values[column].IsNull()) {
+		values[column] = value;
+	}
+	return true;
+}
 
-	} else if (filter_expr.type == ExpressionType::COMPARE_BETWEEN) {
-		auto &between = filter_expr.Cast<BoundBetweenExpression>();
-		if (!between.input->Equals(expr)) {
-			// The expression does not match the index expression.
-			return nullptr;
+static void AddLowerBound(ARTColumnPredicates &predicates, const Value &value, const ExpressionType comparison_type) {
+	if (predicates.low_value.IsNull()) {
+		predicates.low_value = value;
+		predicates.low_expression = comparison_type;
+	}
+}
+
+static void AddUpperBound(ARTColumnPredicates &predicates, const Value &value, const ExpressionType comparison_type) {
+	if (predicates.high_value.IsNull()) {
+		predicates.high_value = value;
+		predicates.high_expression = comparison_type;
+	}
+}
+
+unique_ptr<IndexScanState> ART::TryInitializeScan(const vector<unique_ptr<Expression>> &index_expressions,
+                                                  const vector<unique_ptr<Expression>> &filters) {
+	// The index expressions can be a prefix of the index columns.
+	D_ASSERT(!index_expressions.empty() && index_expressions.size() <= types.size());
+	auto column_count = index_expressions.size();
+
+	// Collect the predicates on each index column.
+	vector<ARTColumnPredicates> predicates(column_count);
+	// The points of OR-equalities over multiple columns, e.g., (a = 1 AND b = 2) OR (a = 3 AND b = 4).
+	vector<vector<Value>> or_points;
+
+	for (auto &filter_ptr : filters) {
+		auto &filter = *filter_ptr;
+		idx_t column;
+		ExpressionType comparison_type;
+		Value value;
+		if (MatchComparison(*this, index_expressions, filter, column, comparison_type, value)) {
+			auto &column_predicates = predicates[column];
+			switch (comparison_type) {
+			case ExpressionType::COMPARE_EQUAL:
+				// An equality value overrides an IN list.
+				column_predicates.has_equal = true;
+				column_predicates.equal_values = {value};
+				break;
+			case ExpressionType::COMPARE_GREATERTHAN:
+			case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+				AddLowerBound(column_predicates, value, comparison_type);
+				break;
+			default:
+				AddUpperBound(column_predicates, value, comparison_type);
+				break;
+			}
+			continue;
 		}
 
-		if (between.lower->type != ExpressionType::VALUE_CONSTANT ||
-		    between.upper->type != ExpressionType::VALUE_CONSTANT) {
-			// Not a constant expression.
-			return nullptr;
+		if (filter.type == ExpressionType::COMPARE_BETWEEN) {
+			auto &between = filter.Cast<BoundBetweenExpression>();
+			auto index_column = FindIndexColumn(index_expressions, *between.input);
+			if (!index_column.IsValid() || !IsUsableConstant(*this, index_column.GetIndex(), *between.lower) ||
+			    !IsUsableConstant(*this, index_column.GetIndex(), *between.upper)) {
+				continue;
+			}
+			auto &column_predicates = predicates[index_column.GetIndex()];
+			AddLowerBound(column_predicates, between.lower->Cast<BoundConstantExpression>().value,
+			              between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+			                                      : ExpressionType::COMPARE_GREATERTHAN);
+			AddUpperBound(column_predicates, between.upper->Cast<BoundConstantExpression>().value,
+			              between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+			                                      : ExpressionType::COMPARE_LESSTHAN);
+			continue;
+		}
+
+		if (filter.type == ExpressionType::COMPARE_IN) {
+			auto &in_list = filter.Cast<BoundOperatorExpression>();
+			auto index_column = FindIndexColumn(index_expressions, *in_list.children[0]);
+			if (!index_column.IsValid()) {
+				continue;
+			}
+			vector<Value> values;
+			bool usable = true;
+			for (idx_t i = 1; i < in_list.children.size() && usable; i++) {
+				auto &child = *in_list.children[i];
+				if (child.type == ExpressionType::VALUE_CONSTANT &&
+				    child.Cast<BoundConstantExpression>().value.IsNull()) {
+					// NULL never matches.
+					continue;
+				}
+				usable = IsUsableConstant(*this, index_column.GetIndex(), child);
+				if (usable) {
+					values.push_back(child.Cast<BoundConstantExpression>().value);
+				}
+			}
+			auto &column_predicates = predicates[index_column.GetIndex()];
+			if (usable && !column_predicates.has_equal) {
+				column_predicates.has_equal = true;
+				column_predicates.equal_values = std::move(values);
+			}
+			continue;
 		}
 
-		low_value = between.lower->Cast<BoundConstantExpression>().value;
-		low_comparison_type = between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
-		                                              : ExpressionType::COMPARE_GREATERTHAN;
-		high_value = (between.upper->Cast<BoundConstantExpression>()).value;
-		high_comparison_type =
-		    between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_LESSTHAN;
+		if (filter.type == ExpressionType::CONJUNCTION_OR) {
+			// Every child must be an equality or a conjunction of equalities on the index columns.
+			auto &disjunction = filter.Cast<BoundConjunctionExpression>();
+			vector<vector<Value>> points;
+			for (auto &child : disjunction.children) {
+				vector<Value> point(column_count);
+				if (!MatchEqualities(*this, index_expressions, *child, point)) {
+					points.clear();
+					break;
+				}
+				points.push_back(std::move(point));
+			}
+			if (points.empty()) {
+				continue;
+			}
+
+			// OR-equalities on a single column are an IN list.
+			optional_idx single_column;
+			bool multiple_columns = false;
+			for (auto &point : points) {
+				for (idx_t i = 0; i < column_count; i++) {
+					if (point[i].IsNull()) {
+						continue;
+					}
+					if (!single_column.IsValid()) {
+						single_column = i;
+					} else if (single_column.GetIndex() != i) {
+						multiple_columns = true;
+					}
+				}
+			}
+			if (!multiple_columns) {
+				auto column = single_column.GetIndex();
+				auto &column_predicates = predicates[column];
+				if (!column_predicates.has_equal) {
+					column_predicates.has_equal = true;
+					for (auto &point : points) {
+						column_predicates.equal_values.push_back(point[column]);
+					}
+				}
+				continue;
+			}
+
+			// Otherwise, we look up the equalities on the leading index columns of each child.
+			if (!or_points.empty()) {
+				continue;
+			}
+			for (auto &point : points) {
+				idx_t prefix_length = 0;
+				while (prefix_length < column_count && !point[prefix_length].IsNull()) {
+					prefix_length++;
+				}
+				if (prefix_length == 0) {
+					or_points.clear();
+					break;
+				}
+				point.resize(prefix_length);
+				or_points.push_back(std::move(point));
+			}
+		}
 	}
 
-	// We cannot use an index scan.
-	if (equal_value.IsNull() && low_value.IsNull() && high_value.IsNull()) {
-		return nullptr;
+	// Combine the equalities on the leading index columns into prefixes.
+	vector<vector<Value>> prefixes(1);
+	idx_t prefix_length = 0;
+	for (; prefix_length < column_count; prefix_length++) {
+		auto &column_predicates = predicates[prefix_length];
+		if (!column_predicates.has_equal) {
+			break;
+		}
+		auto &values = column_predicates.equal_values;
+		if (prefixes.size() * values.size() > MAX_INDEX_SCAN_PREFIXES) {
+			break;
+		}
+		vector<vector<Value>> new_prefixes;
+		for (auto &prefix : prefixes) {
+			for (auto &value : values) {
+				new_prefixes.push_back(prefix);
+				new_prefixes.back().push_back(value);
+			}
+		}
+		prefixes = std::move(new_prefixes);
 	}
 
-	// Initialize the index scan state and return it.
-	if (!equal_value.IsNull()) {
-		// Equality predicate.
-		return InitializeScanSinglePredicate(equal_value, ExpressionType::COMPARE_EQUAL);
+	ARTColumnPredicates range;
+	if (prefix_length < column_count) {
+		range = predicates[prefix_length];
 	}
-	if (!low_value.IsNull() && !high_value.IsNull()) {
-		// Two-sided predicate.
-		return InitializeScanTwoPredicates(low_value, low_comparison_type, high_value, high_comparison_type);
+	auto has_range = !range.low_value.IsNull() || !range.high_value.IsNull();
+
+	if (prefix_length == 0 && !has_range) {
+		if (or_points.empty() || or_points.size() > MAX_INDEX_SCAN_PREFIXES) {
+			// We cannot use an index scan.
+			return nullptr;
+		}
+		prefixes = std::move(or_points);
 	}
-	if (!low_value.IsNull()) {
+
+	// Initialize the index scan state and return it.
+	if (prefix_length == 0 && has_range && types.size() == 1) {
+		if (!range.low_value.IsNull() && !range.high_value.IsNull()) {
+			// Two-sided predicate.
+			return InitializeScanTwoPredicates(range.low_value, range.low_expression, range.high_value,
+			                                   range.high_expression);
+		}
+		if (!range.low_value.IsNull()) {
+			// Greater-than predicate.
+			return InitializeScanSinglePredicate(range.low_value, range.low_expression);
+		}
 		// Less-than predicate.
-		return InitializeScanSinglePredicate(low_value, low_comparison_type);
+		return InitializeScanSinglePredicate(range.high_value, range.high_expression);
 	}
-	// Greater-than predicate.
-	return InitializeScanSinglePredicate(high_value, high_comparison_type);
+
+	auto result = make_uniq<ARTIndexScanState>();
+	result->prefix_scan = true;
+	result->prefixes = std::move(prefixes);
+	if (has_range) {
+		result->low_value = range.low_value;
+		result->low_expression = range.low_expression;
+		result->high_value = range.high_value;
+		result->high_expression = range.high_expression;
+	}
+	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
@@ -485,6 +719,7 @@ ErrorData ART::Insert(IndexLock &lock, DataChunk &input, Vector &row_ids) {
 	unsafe_vector<ARTKey> keys(row_count);
 	unsafe_vector<ARTKey> row_id_keys(row_count);
 	GenerateKeyVectors(allocator, input, row_ids, keys, row_id_keys);
+	EvictColdBuffers();
 
 	// Insert the entries into the index.
 	idx_t failed_index = DConstants::INVALID_INDEX;
@@ -669,6 +904,7 @@ void ART::Delete(IndexLock &state, DataChunk &input, Vector &row_ids) {
 	unsafe_vector<ARTKey> keys(row_count);
 	unsafe_vector<ARTKey> row_id_keys(row_count);
 	GenerateKeyVectors(allocator, expr_chunk, row_ids, keys, row_id_keys);
+	EvictColdBuffers();
 
 	for (idx_t i = 0; i < row_count; i++) {
 		if (keys[i].Empty()) {
@@ -833,7 +1069,8 @@ const unsafe_optional_ptr<const Node> ART::Lookup(const Node &node, const ARTKey
 	return nullptr;
 }
 
-bool ART::SearchEqual(ARTKey &key, idx_t max_count, unsafe_vector<row_t> &row_ids) {
+bool ART::SearchEqual(ARTKey &key, idx_t max_count, unsafe_vector<row_t> &row_ids,
+                      optional_ptr<ARTKeyList> keys) {
 	auto leaf = Lookup(tree, key, 0);
 	if (!leaf) {
 		return true;
@@ -842,10 +1079,19 @@ bool ART::SearchEqual(ARTKey &key, idx_t max_count, unsafe_vector<row_t> &row_id
 	Iterator it(*this);
 	it.FindMinimum(*leaf);
 	ARTKey empty_key = ARTKey();
-	return it.Scan(empty_key, max_count, row_ids, false);
+	auto row_id_count = row_ids.size();
+	if (!it.Scan(empty_key, max_count, row_ids, false)) {
+		return false;
+	}
+	if (keys) {
+		// The iterator starts at the leaf, so we add the search key.
+		keys->Append(key.data, key.len, row_ids.size() - row_id_count);
+	}
+	return true;
 }
 
-bool ART::SearchGreater(ARTKey &key, bool equal, idx_t max_count, unsafe_vector<row_t> &row_ids) {
+bool ART::SearchGreater(ARTKey &key, bool equal, idx_t max_count, unsafe_vector<row_t> &row_ids,
+                        optional_ptr<ARTKeyList> keys) {
 	if (!tree.HasMetadata()) {
 		return true;
 	}
@@ -860,10 +1106,11 @@ bool ART::SearchGreater(ARTKey &key, bool equal, idx_t max_count, unsafe_vector<
 
 	// We continue the scan. We do not check the bounds as any value following this value is
 	// greater and satisfies our predicate.
-	return it.Scan(ARTKey(), max_count, row_ids, false);
+	return it.Scan(ARTKey(), max_count, row_ids, false, keys);
 }
 
-bool ART::SearchLess(ARTKey &upper_bound, bool equal, idx_t max_count, unsafe_vector<row_t> &row_ids) {
+bool ART::SearchLess(ARTKey &upper_bound, bool equal, idx_t max_count, unsafe_vector<row_t> &row_ids,
+                     optional_ptr<ARTKeyList> keys) {
 	if (!tree.HasMetadata()) {
 		return true;
 	}
@@ -878,11 +1125,11 @@ bool ART::SearchLess(ARTKey &upper_bound, bool equal, idx_t max_count, unsafe_ve
 	}
 
 	// Continue the scan until we reach the upper bound.
-	return it.Scan(upper_bound, max_count, row_ids, equal);
+	return it.Scan(upper_bound, max_count, row_ids, equal, keys);
 }
 
 bool ART::SearchCloseRange(ARTKey &lower_bound, ARTKey &upper_bound, bool left_equal, bool right_equal, idx_t max_count,
-                           unsafe_vector<row_t> &row_ids) {
+                           unsafe_vector<row_t> &row_ids, optional_ptr<ARTKeyList> keys) {
 	// Find the first node that satisfies the left predicate.
 	Iterator it(*this);
 
@@ -892,11 +1139,166 @@ bool ART::SearchCloseRange(ARTKey &lower_bound, ARTKey &upper_bound, bool left_e
 	}
 
 	// Continue the scan until we reach the upper bound.
-	return it.Scan(upper_bound, max_count, row_ids, right_equal);
+	return it.Scan(upper_bound, max_count, row_ids, right_equal, keys);
+}
+
+bool ART::SearchPrefixRange(const ARTKey &lower_bound, const ARTKey &upper_bound, const idx_t max_count,
+                            unsafe_vector<row_t> &row_ids, optional_ptr<ARTKeyList> keys) {
+	if (!tree.HasMetadata()) {
+		return true;
+	}
+
+	// Find the lowest value that has the lower bound as its prefix, or that is greater than the lower bound.
+	Iterator it(*this);
+	if (!it.LowerBound(tree, lower_bound, true, 0)) {
+		return true;
+	}
+
+	// Continue the scan until we reach a value that is greater than or equal to the upper bound.
+	return it.Scan(upper_bound, max_count, row_ids, false, keys);
+}
+
+//! Returns the smallest key that is greater than all keys with the given prefix.
+//! Returns an empty key, if no such key exists.
+static ARTKey IncrementKey(ArenaAllocator &allocator, const ARTKey &key) {
+	auto len = key.len;
+	while (len > 0 && key.data[len - 1] == NumericLimits<uint8_t>::Maximum()) {
+		len--;
+	}
+	if (len == 0) {
+		return ARTKey();
+	}
+	ARTKey result(allocator, len);
+	memcpy(result.data, key.data, len);
+	result.data[len - 1]++;
+	return result;
+}
+
+static ARTKey ConcatKeys(ArenaAllocator &allocator, const ARTKey &prefix, const ARTKey &key) {
+	if (prefix.Empty()) {
+		return key;
+	}
+	auto result = prefix;
+	result.Concat(allocator, key);
+	return result;
+}
+
+bool ART::ScanPrefixes(ARTIndexScanState &state, const idx_t max_count, unsafe_vector<row_t> &row_ids,
+                       optional_ptr<ARTKeyList> keys) {
+	ArenaAllocator arena_allocator(Allocator::Get(db));
+	auto has_range = !state.low_value.IsNull() || !state.high_value.IsNull();
+
+	lock_guard<mutex> l(lock);
+	EvictColdBuffers();
+	for (auto &prefix : state.prefixes) {
+		ARTKey key;
+		for (idx_t i = 0; i < prefix.size(); i++) {
+			D_ASSERT(prefix[i].type().InternalType() == types[i]);
+			key = ConcatKeys(arena_allocator, key, ARTKey::CreateKey(arena_allocator, types[i], prefix[i]));
+		}
+
+		if (!has_range) {
+			if (prefix.size() == types.size()) {
+				// Point lookup.
+				if (!SearchEqual(key, max_count, row_ids, keys)) {
+					return false;
+				}
+				continue;
+			}
+			// Prefix scan.
+			if (!SearchPrefixRange(key, IncrementKey(arena_allocator, key), max_count, row_ids, keys)) {
+				return false;
+			}
+			continue;
+		}
+
+		// Range scan on the index column following the prefix.
+		auto column = prefix.size();
+		D_ASSERT(column < types.size());
+		auto lower_bound = key;
+		if (!state.low_value.IsNull()) {
+			lower_bound =
+			    ConcatKeys(arena_allocator, key, ARTKey::CreateKey(arena_allocator, types[column], state.low_value));
+			if (state.low_expression == ExpressionType::COMPARE_GREATERTHAN) {
+				// Skip all keys with the lower bound as their prefix.
+				lower_bound = IncrementKey(arena_allocator, lower_bound);
+				if (lower_bound.Empty()) {
+					continue;
+				}
+			}
+		}
+		ARTKey upper_bound;
+		if (!state.high_value.IsNull()) {
+			upper_bound =
+			    ConcatKeys(arena_allocator, key, ARTKey::CreateKey(arena_allocator, types[column], state.high_value));
+			if (state.high_expression == ExpressionType::COMPARE_LESSTHANOREQUALTO) {
+				// Include all keys with the upper bound as their prefix.
+				upper_bound = IncrementKey(arena_allocator, upper_bound);
+			}
+		} else {
+			upper_bound = IncrementKey(arena_allocator, key);
+		}
+		if (!SearchPrefixRange(lower_bound, upper_bound, max_count, row_ids, keys)) {
+			return false;
+		}
+	}
+	return true;
 }
 
 bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t> &row_ids) {
+	if (!ScanInternal(state, max_count, row_ids, nullptr)) {
+		return false;
+	}
+
+	// We return the row IDs in ascending order, which makes fetching them from the table cheaper.
+	// Point lookups and prefix scans of overlapping IN lists or OR-equalities can return duplicates.
+	std::sort(row_ids.begin(), row_ids.end());
+	row_ids.erase(std::unique(row_ids.begin(), row_ids.end()), row_ids.end());
+	return true;
+}
+
+bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t> &row_ids, ARTKeyList &keys) {
+	D_ASSERT(row_ids.empty());
+	keys.Clear();
+	if (!ScanInternal(state, max_count, row_ids, keys)) {
+		return false;
+	}
+	D_ASSERT(keys.Count() == row_ids.size());
+
+	// Same as above, but we reorder the keys with their row IDs.
+	unsafe_vector<idx_t> order(row_ids.size());
+	for (idx_t i = 0; i < order.size(); i++) {
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), [&](const idx_t a, const idx_t b) { return row_ids[a] < row_ids[b]; });
+
+	unsafe_vector<row_t> sorted_row_ids;
+	ARTKeyList sorted_keys;
+	sorted_row_ids.reserve(row_ids.size());
+	for (auto i : order) {
+		if (!sorted_row_ids.empty() && sorted_row_ids.back() == row_ids[i]) {
+			continue;
+		}
+		sorted_row_ids.push_back(row_ids[i]);
+		auto offset = keys.offsets[i];
+		sorted_keys.Append(keys.data.data() + offset, keys.offsets[i + 1] - offset);
+	}
+	row_ids = std::move(sorted_row_ids);
+	keys = std::move(sorted_keys);
+	return true;
+}
+
+bool ART::ScanInternal(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t> &row_ids,
+                       optional_ptr<ARTKeyList> keys) {
 	auto &scan_state = state.Cast<ARTIndexScanState>();
+	if (scan_state.prefix_scan) {
+		return ScanPrefixes(scan_state, max_count, row_ids, keys);
+	}
+	return ScanPredicates(scan_state, max_count, row_ids, keys);
+}
+
+bool ART::ScanPredicates(ARTIndexScanState &scan_state, const idx_t max_count, unsafe_vector<row_t> &row_ids,
+                         optional_ptr<ARTKeyList> keys) {
 	D_ASSERT(scan_state.values[0].type().InternalType() == types[0]);
 	ArenaAllocator arena_allocator(Allocator::Get(db));
 	auto key = ARTKey::CreateKey(arena_allocator, types[0], scan_state.values[0]);
@@ -904,17 +1306,18 @@ bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t
 	if (scan_state.values[1].IsNull()) {
 		// Single predicate.
 		lock_guard<mutex> l(lock);
+		EvictColdBuffers();
 		switch (scan_state.expressions[0]) {
 		case ExpressionType::COMPARE_EQUAL:
-			return SearchEqual(key, max_count, row_ids);
+			return SearchEqual(key, max_count, row_ids, keys);
 		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
-			return SearchGreater(key, true, max_count, row_ids);
+			return SearchGreater(key, true, max_count, row_ids, keys);
 		case ExpressionType::COMPARE_GREATERTHAN:
-			return SearchGreater(key, false, max_count, row_ids);
+			return SearchGreater(key, false, max_count, row_ids, keys);
 		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
-			return SearchLess(key, true, max_count, row_ids);
+			return SearchLess(key, true, max_count, row_ids, keys);
 		case ExpressionType::COMPARE_LESSTHAN:
-			return SearchLess(key, false, max_count, row_ids);
+			return SearchLess(key, false, max_count, row_ids, keys);
 		default:
 			throw InternalException("Index scan type not implemented");
 		}
@@ -922,11 +1325,29 @@ bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t
 
 	// Two predicates.
 	lock_guard<mutex> l(lock);
+	EvictColdBuffers();
 	D_ASSERT(scan_state.values[1].type().InternalType() == types[0]);
 	auto upper_bound = ARTKey::CreateKey(arena_allocator, types[0], scan_state.values[1]);
 	bool left_equal = scan_state.expressions[0] == ExpressionType ::COMPARE_GREATERTHANOREQUALTO;
 	bool right_equal = scan_state.expressions[1] == ExpressionType ::COMPARE_LESSTHANOREQUALTO;
-	return SearchCloseRange(key, upper_bound, left_equal, right_equal, max_count, row_ids);
+	return SearchCloseRange(key, upper_bound, left_equal, right_equal, max_count, row_ids, keys);
+}
+
+void ART::SearchEqualJoin(unsafe_vector<ARTKey> &keys, const idx_t count, unsafe_vector<row_t> &row_ids,
+                          unsafe_vector<idx_t> &offsets) {
+	row_ids.clear();
+	offsets.resize(count + 1);
+	offsets[0] = 0;
+
+	// Lock once for the entire batch.
+	lock_guard<mutex> l(lock);
+	EvictColdBuffers();
+	for (idx_t i = 0; i < count; i++) {
+		if (!keys[i].Empty()) {
+			SearchEqual(keys[i], NumericLimits<idx_t>::Maximum(), row_ids);
+		}
+		offsets[i + 1] = row_ids.size();
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -978,6 +1399,7 @@ string ART::GenerateConstraintErrorMessage(VerifyExistenceType verify_type, cons
 void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
 	// Lock the index during constraint checking.
 	lock_guard<mutex> l(lock);
+	EvictColdBuffers();
 
 	DataChunk expr_chunk;
 	expr_chunk.Initialize(Allocator::DefaultAllocator(), logical_types);
@@ -1119,6 +1541,20 @@ void ART::InitAllocators(const IndexStorageInfo &info) {
 	}
 }
 
+void ART::EvictColdBuffers() {
+	// ARTs sharing the allocators of another ART never unload its buffers.
+	if (!owns_data) {
+		return;
+	}
+	auto evict = (*allocators)[0]->UnderMemoryPressure();
+	for (auto &allocator : *allocators) {
+		allocator->NextAccessEpoch();
+		if (evict) {
+			allocator->EvictColdBuffers();
+		}
+	}
+}
+
 void ART::Deserialize(const BlockPointer &pointer) {
 	D_ASSERT(pointer.IsValid());
 
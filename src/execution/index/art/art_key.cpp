@@ -98,6 +98,94 @@ ARTKey ARTKey::CreateKey(ArenaAllocator &allocator, PhysicalType type, Value &va
 	}
 }
 
+bool ARTKey::CanDecode(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT128:
+	case PhysicalType::VARCHAR:
+		return true;
+	default:
+		// We normalize floating point values (-0.0, NaN) when encoding them.
+		return false;
+	}
+}
+
+template <class T>
+static idx_t DecodeFixedSize(const_data_ptr_t data, idx_t offset, optional_ptr<Vector> result, idx_t result_idx) {
+	if (result) {
+		FlatVector::GetData<T>(*result)[result_idx] = Radix::DecodeData<T>(data + offset);
+	}
+	return offset + sizeof(T);
+}
+
+static idx_t DecodeString(const_data_ptr_t data, idx_t offset, optional_ptr<Vector> result, idx_t result_idx) {
+	// Strings are null-terminated, and \00 and \01 are escaped with \01.
+	idx_t string_len = 0;
+	idx_t pos = offset;
+	for (; data[pos] != '\0'; pos++) {
+		if (data[pos] == '\01') {
+			pos++;
+		}
+		string_len++;
+	}
+	if (result) {
+		auto str = StringVector::EmptyString(*result, string_len);
+		auto str_data = str.GetDataWriteable();
+		idx_t str_pos = 0;
+		for (idx_t i = offset; i < pos; i++) {
+			if (data[i] == '\01') {
+				i++;
+			}
+			str_data[str_pos++] = const_char_ptr_cast(data)[i];
+		}
+		str.Finalize();
+		FlatVector::GetData<string_t>(*result)[result_idx] = str;
+	}
+	return pos + 1;
+}
+
+idx_t ARTKey::Decode(PhysicalType type, const_data_ptr_t data, idx_t offset, optional_ptr<Vector> result,
+                     idx_t result_idx) {
+	D_ASSERT(!result || result->GetType().InternalType() == type);
+	switch (type) {
+	case PhysicalType::BOOL:
+		return DecodeFixedSize<bool>(data, offset, result, result_idx);
+	case PhysicalType::INT8:
+		return DecodeFixedSize<int8_t>(data, offset, result, result_idx);
+	case PhysicalType::INT16:
+		return DecodeFixedSize<int16_t>(data, offset, result, result_idx);
+	case PhysicalType::INT32:
+		return DecodeFixedSize<int32_t>(data, offset, result, result_idx);
+	case PhysicalType::INT64:
+		return DecodeFixedSize<int64_t>(data, offset, result, result_idx);
+	case PhysicalType::UINT8:
+		return DecodeFixedSize<uint8_t>(data, offset, result, result_idx);
+	case PhysicalType::UINT16:
+		return DecodeFixedSize<uint16_t>(data, offset, result, result_idx);
+	case PhysicalType::UINT32:
+		return DecodeFixedSize<uint32_t>(data, offset, result, result_idx);
+	case PhysicalType::UINT64:
+		return DecodeFixedSize<uint64_t>(data, offset, result, result_idx);
+	case PhysicalType::INT128:
+		return DecodeFixedSize<hugeint_t>(data, offset, result, result_idx);
+	case PhysicalType::UINT128:
+		return DecodeFixedSize<uhugeint_t>(data, offset, result, result_idx);
+	case PhysicalType::VARCHAR:
+		return DecodeString(data, offset, result, result_idx);
+	default:
+		throw InternalException("Invalid type for decoding an ART key.");
+	}
+}
+
 bool ARTKey::operator>(const ARTKey &key) const {
 	for (idx_t i = 0; i < MinValue(len, key.len); i++) {
 		if (data[i] > key.data[i]) {
@@ -156,6 +244,20 @@ idx_t ARTKey::GetMismatchPos(const ARTKey &other, const idx_t start) const {
 	return DConstants::INVALID_INDEX;
 }
 
+//===--------------------------------------------------------------------===//
+// ARTKeyList
+//===--------------------------------------------------------------------===//
+
+void ARTKeyList::Append(const_data_ptr_t key_data, idx_t len, idx_t count) {
+	if (offsets.empty()) {
+		offsets.push_back(0);
+	}
+	for (idx_t i = 0; i < count; i++) {
+		data.insert(data.end(), key_data, key_data + len);
+		offsets.push_back(data.size());
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // ARTKeySection
 //===--------------------------------------------------------------------===//
@@ -42,7 +42,8 @@ bool IteratorKey::GreaterThan(const ARTKey &key, const bool equal, const uint8_t
 // Iterator
 //===--------------------------------------------------------------------===//
 
-bool Iterator::Scan(const ARTKey &upper_bound, const idx_t max_count, unsafe_vector<row_t> &row_ids, const bool equal) {
+bool Iterator::Scan(const ARTKey &upper_bound, const idx_t max_count, unsafe_vector<row_t> &row_ids, const bool equal,
+                    optional_ptr<ARTKeyList> keys) {
 	bool has_next;
 	do {
 		// An empty upper bound indicates that no upper bound exists.
@@ -52,6 +53,7 @@ bool Iterator::Scan(const ARTKey &upper_bound, const idx_t max_count, unsafe_vec
 			}
 		}
 
+		auto row_id_count = row_ids.size();
 		switch (last_leaf.GetType()) {
 		case NType::LEAF_INLINED:
 			if (row_ids.size() + 1 > max_count) {
@@ -86,6 +88,10 @@ bool Iterator::Scan(const ARTKey &upper_bound, const idx_t max_count, unsafe_vec
 			throw InternalException("Invalid leaf type for index scan.");
 		}
 
+		if (keys) {
+			// The bytes following the gate are row ID bytes.
+			keys->Append(current_key.Data(), current_key.Size() - nested_depth, row_ids.size() - row_id_count);
+		}
 		has_next = Next();
 	} while (has_next);
 	return true;
@@ -160,6 +166,13 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 	}
 
 	D_ASSERT(node.GetGateStatus() == GateStatus::GATE_NOT_SET);
+
+	// The key is a prefix of all keys in this subtree, so they are all greater than the key.
+	if (depth >= key.len) {
+		FindMinimum(node);
+		return true;
+	}
+
 	if (node.GetType() != NType::PREFIX) {
 		auto next_byte = key[depth];
 		auto child = node.GetNextChild(art, next_byte);
@@ -191,6 +204,12 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 
 	// We compare the prefix bytes with the key bytes.
 	for (idx_t i = 0; i < prefix.data[Prefix::Count(art)]; i++) {
+		// The key ends within the prefix, i.e., it is a prefix of all keys in the subsequent node.
+		if (depth + i >= key.len) {
+			FindMinimum(*prefix.ptr);
+			return true;
+		}
+
 		// We found a prefix byte that is less than its corresponding key byte.
 		// I.e., the subsequent node is lesser than the key. Thus, the next node
 		// is the lower bound.
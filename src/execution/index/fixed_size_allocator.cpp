@@ -1,12 +1,13 @@
 #include "duckdb/execution/index/fixed_size_allocator.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 
 namespace duckdb {
 
 FixedSizeAllocator::FixedSizeAllocator(const idx_t segment_size, BlockManager &block_manager)
     : block_manager(block_manager), buffer_manager(block_manager.buffer_manager), segment_size(segment_size),
-      total_segment_count(0) {
+      total_segment_count(0), access_epoch(0) {
 
 	if (segment_size > block_manager.GetBlockSize() - sizeof(validity_t)) {
 		throw InternalException("The maximum segment size of fixed-size allocators is " +
@@ -132,6 +133,38 @@ idx_t FixedSizeAllocator::GetInMemorySize() const {
 	return memory_usage;
 }
 
+bool FixedSizeAllocator::UnderMemoryPressure() const {
+	auto max_memory = buffer_manager.GetMaxMemory();
+	auto threshold = max_memory / 100 * EVICTION_THRESHOLD;
+	return buffer_manager.GetUsedMemory() >= threshold;
+}
+
+idx_t FixedSizeAllocator::EvictColdBuffers() {
+	vector<idx_t> access_epochs;
+	for (auto &buffer : buffers) {
+		if (buffer.second.CanUnload()) {
+			access_epochs.push_back(buffer.second.last_access);
+		}
+	}
+	if (access_epochs.empty()) {
+		return 0;
+	}
+
+	// We keep the more recently accessed half of the buffers in memory, e.g., the buffers of the upper levels.
+	auto median = access_epochs.begin() + NumericCast<int64_t>((access_epochs.size() - 1) / 2);
+	std::nth_element(access_epochs.begin(), median, access_epochs.end());
+	auto max_epoch = *median;
+
+	idx_t evicted_count = 0;
+	for (auto &buffer : buffers) {
+		if (buffer.second.CanUnload() && buffer.second.last_access <= max_epoch) {
+			buffer.second.Unload();
+			evicted_count++;
+		}
+	}
+	return evicted_count;
+}
+
 idx_t FixedSizeAllocator::GetUpperBoundBufferId() const {
 	idx_t upper_bound_id = 0;
 	for (auto &buffer : buffers) {
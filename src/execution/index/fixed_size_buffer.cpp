@@ -36,8 +36,8 @@ constexpr idx_t FixedSizeBuffer::BASE[];
 constexpr uint8_t FixedSizeBuffer::SHIFT[];
 
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager)
-    : block_manager(block_manager), segment_count(0), allocation_size(0), dirty(false), vacuum(false), block_pointer(),
-      block_handle(nullptr) {
+    : block_manager(block_manager), segment_count(0), allocation_size(0), dirty(false), vacuum(false), last_access(0),
+      block_pointer(), block_handle(nullptr) {
 
 	auto &buffer_manager = block_manager.buffer_manager;
 	buffer_handle = buffer_manager.Allocate(MemoryTag::ART_INDEX, block_manager.GetBlockSize(), false);
@@ -47,7 +47,7 @@ FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager)
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager, const idx_t segment_count, const idx_t allocation_size,
                                  const BlockPointer &block_pointer)
     : block_manager(block_manager), segment_count(segment_count), allocation_size(allocation_size), dirty(false),
-      vacuum(false), block_pointer(block_pointer) {
+      vacuum(false), last_access(0), block_pointer(block_pointer) {
 
 	D_ASSERT(block_pointer.IsValid());
 	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
@@ -146,6 +146,16 @@ void FixedSizeBuffer::Pin() {
 	block_handle = std::move(new_block_handle);
 }
 
+void FixedSizeBuffer::Unload() {
+	D_ASSERT(CanUnload());
+
+	// Destroying the buffer handle frees the in-memory copy. The on-disk block is managed by the buffer manager,
+	// i.e., it can stay cached until the buffer manager evicts it.
+	buffer_handle.Destroy();
+	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
+	D_ASSERT(block_handle->BlockId() < MAXIMUM_BLOCK);
+}
+
 uint32_t FixedSizeBuffer::GetOffset(const idx_t bitmask_count) {
 
 	// get the bitmask data
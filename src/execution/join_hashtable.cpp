@@ -1,5 +1,6 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -34,7 +35,7 @@ JoinHashTable::JoinHashTable(ClientContext &context, const vector<JoinCondition>
     : buffer_manager(BufferManager::GetBufferManager(context)), conditions(conditions_p),
       build_types(std::move(btypes)), output_columns(output_columns_p), entry_size(0), tuple_size(0),
       vfound(Value::BOOLEAN(false)), join_type(type_p), finalized(false), has_null(false),
-      radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
+      radix_bits(INITIAL_RADIX_BITS) {
 	for (idx_t i = 0; i < conditions.size(); ++i) {
 		auto &condition = conditions[i];
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
@@ -1379,7 +1380,11 @@ idx_t JoinHashTable::GetRemainingSize() const {
 
 	idx_t count = 0;
 	idx_t data_size = 0;
-	for (idx_t partition_idx = partition_end; partition_idx < num_partitions; partition_idx++) {
+	for (idx_t partition_idx = 0; partition_idx < num_partitions; partition_idx++) {
+		if (IsCurrentPartition(partition_idx) ||
+		    (partition_idx < completed_partitions.size() && completed_partitions[partition_idx])) {
+			continue;
+		}
 		count += partitions[partition_idx]->Count();
 		data_size += partitions[partition_idx]->SizeInBytes();
 	}
@@ -1387,6 +1392,29 @@ idx_t JoinHashTable::GetRemainingSize() const {
 	return data_size + PointerTableSize(count);
 }
 
+idx_t JoinHashTable::GetMaxRemainingPartitionSize() const {
+	auto &partitions = sink_collection->GetPartitions();
+
+	idx_t max_partition_ht_size = 0;
+	for (idx_t partition_idx = 0; partition_idx < partitions.size(); partition_idx++) {
+		if (completed_partitions[partition_idx]) {
+			continue;
+		}
+		auto &partition = *partitions[partition_idx];
+		max_partition_ht_size =
+		    MaxValue(max_partition_ht_size, partition.SizeInBytes() + PointerTableSize(partition.Count()));
+	}
+	return max_partition_ht_size;
+}
+
+idx_t JoinHashTable::GetCompletedPartitionCount() const {
+	return NumericCast<idx_t>(std::count(completed_partitions.begin(), completed_partitions.end(), true));
+}
+
+idx_t JoinHashTable::GetCurrentPartitionCount() const {
+	return NumericCast<idx_t>(std::count(current_partitions.begin(), current_partitions.end(), true));
+}
+
 void JoinHashTable::Unpartition() {
 	data_collection = sink_collection->GetUnpartitioned();
 }
@@ -1429,39 +1457,140 @@ void JoinHashTable::Reset() {
 	finalized = false;
 }
 
-bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
+bool JoinHashTable::SplitPartitions(const idx_t max_ht_size, ProbeSpill &probe_spill) {
+	const auto max_partition_ht_size = GetMaxRemainingPartitionSize();
+	if (max_partition_ht_size <= max_ht_size || radix_bits >= RadixPartitioning::MAX_RADIX_BITS) {
+		return false;
+	}
+
+	// Find the largest remaining partition, and determine which partitions do not fit by themselves
+	const auto old_num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	auto old_sink_collection = std::move(sink_collection);
+	auto &old_partitions = old_sink_collection->GetPartitions();
+	vector<bool> split_partitions(old_num_partitions, false);
+	idx_t max_partition_size = 0;
+	idx_t max_partition_count = 0;
+	for (idx_t partition_idx = 0; partition_idx < old_num_partitions; partition_idx++) {
+		if (completed_partitions[partition_idx]) {
+			continue;
+		}
+		auto &partition = *old_partitions[partition_idx];
+		const auto partition_ht_size = partition.SizeInBytes() + PointerTableSize(partition.Count());
+		if (partition_ht_size > max_ht_size) {
+			split_partitions[partition_idx] = true;
+		}
+		if (partition_ht_size == max_partition_ht_size) {
+			max_partition_size = partition.SizeInBytes();
+			max_partition_count = partition.Count();
+		}
+	}
+
+	// This creates a new (empty) sink collection with the increased radix bits
+	const auto old_radix_bits = radix_bits;
+	SetRepartitionRadixBits(max_ht_size, max_partition_size, max_partition_count);
+	const auto added_bits = radix_bits - old_radix_bits;
+	const auto multiplier = RadixPartitioning::NumberOfPartitions(added_bits);
+
+	// The radix bits are taken from the top of the hash, so partition i maps to [i * multiplier, (i + 1) * multiplier)
+	PartitionedTupleDataAppendState append_state;
+	sink_collection->InitializeAppendState(append_state);
+	for (idx_t partition_idx = 0; partition_idx < old_num_partitions; partition_idx++) {
+		if (!split_partitions[partition_idx]) {
+			continue;
+		}
+		auto &partition = *old_partitions[partition_idx];
+		TupleDataChunkIterator iterator(partition, TupleDataPinProperties::DESTROY_AFTER_DONE, true);
+		auto &chunk_state = iterator.GetChunkState();
+		do {
+			sink_collection->Append(append_state, chunk_state, iterator.GetCurrentChunkCount());
+		} while (iterator.Next());
+		partition.Reset();
+	}
+	sink_collection->FlushAppendState(append_state);
+
+	// The partitions that fit are moved as a whole
+	auto &new_partitions = sink_collection->GetPartitions();
+	vector<bool> new_completed_partitions(RadixPartitioning::NumberOfPartitions(radix_bits), false);
+	for (idx_t partition_idx = 0; partition_idx < old_num_partitions; partition_idx++) {
+		const auto new_partition_idx = partition_idx * multiplier;
+		if (completed_partitions[partition_idx]) {
+			for (idx_t i = 0; i < multiplier; i++) {
+				new_completed_partitions[new_partition_idx + i] = true;
+			}
+		} else if (!split_partitions[partition_idx]) {
+			new_partitions[new_partition_idx] = std::move(old_partitions[partition_idx]);
+		}
+	}
+	completed_partitions = std::move(new_completed_partitions);
+	current_partitions.assign(completed_partitions.size(), false);
+
+	probe_spill.Repartition(added_bits, split_partitions);
+
+	// If all data ended up in the same partition (e.g., a single key), splitting further does not help
+	return GetMaxRemainingPartitionSize() < max_partition_ht_size;
+}
+
+bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size, optional_ptr<ProbeSpill> probe_spill) {
 	if (finalized) {
 		Reset();
 	}
 
-	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
-	if (partition_end == num_partitions) {
-		return false;
+	auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	if (current_partitions.empty()) {
+		completed_partitions.resize(num_partitions, false);
+		current_partitions.resize(num_partitions, false);
+	}
+
+	// The partitions of the previous round are done
+	for (idx_t partition_idx = 0; partition_idx < num_partitions; partition_idx++) {
+		if (current_partitions[partition_idx]) {
+			completed_partitions[partition_idx] = true;
+			current_partitions[partition_idx] = false;
+		}
+	}
+
+	// The available memory may have shrunk since we partitioned, split the partitions that no longer fit
+	if (probe_spill) {
+		while (SplitPartitions(max_ht_size, *probe_spill)) {
+		}
+		num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
 	}
 
-	// Start where we left off
 	auto &partitions = sink_collection->GetPartitions();
-	partition_start = partition_end;
+	vector<idx_t> remaining_partitions;
+	for (idx_t partition_idx = 0; partition_idx < num_partitions; partition_idx++) {
+		if (!completed_partitions[partition_idx]) {
+			remaining_partitions.push_back(partition_idx);
+		}
+	}
+	if (remaining_partitions.empty()) {
+		return false;
+	}
 
-	// Determine how many partitions we can do next (at least one)
+	// Determine which partitions we can do next (at least one): we consider the largest partitions first,
+	// and fill up the remaining space with any smaller partition that still fits, regardless of its index
+	std::stable_sort(remaining_partitions.begin(), remaining_partitions.end(), [&](const idx_t &lhs, const idx_t &rhs) {
+		return partitions[lhs]->SizeInBytes() > partitions[rhs]->SizeInBytes();
+	});
 	idx_t count = 0;
 	idx_t data_size = 0;
-	idx_t partition_idx;
-	for (partition_idx = partition_start; partition_idx < num_partitions; partition_idx++) {
+	for (const auto &partition_idx : remaining_partitions) {
 		auto incl_count = count + partitions[partition_idx]->Count();
 		auto incl_data_size = data_size + partitions[partition_idx]->SizeInBytes();
 		auto incl_ht_size = incl_data_size + PointerTableSize(incl_count);
 		if (count > 0 && incl_ht_size > max_ht_size) {
-			break;
+			continue;
 		}
 		count = incl_count;
 		data_size = incl_data_size;
+		current_partitions[partition_idx] = true;
 	}
-	partition_end = partition_idx;
 
 	// Move the partitions to the main data collection
-	for (partition_idx = partition_start; partition_idx < partition_end; partition_idx++) {
-		data_collection->Combine(*partitions[partition_idx]);
+	for (idx_t partition_idx = 0; partition_idx < num_partitions; partition_idx++) {
+		if (current_partitions[partition_idx]) {
+			data_collection->Combine(*partitions[partition_idx]);
+		}
 	}
 	D_ASSERT(Count() == count);
 
@@ -1494,9 +1623,21 @@ void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys
 	SelectionVector false_sel;
 	true_sel.Initialize();
 	false_sel.Initialize();
-	auto true_count = RadixPartitioning::Select(hashes, FlatVector::IncrementalSelectionVector(), keys.size(),
-	                                            radix_bits, partition_end, &true_sel, &false_sel);
-	auto false_count = keys.size() - true_count;
+	UnifiedVectorFormat hashes_data;
+	hashes.ToUnifiedFormat(keys.size(), hashes_data);
+	const auto hashes_ptr = UnifiedVectorFormat::GetData<hash_t>(hashes_data);
+	const auto mask = RadixPartitioning::Mask(radix_bits);
+	const auto shift = RadixPartitioning::Shift(radix_bits);
+	idx_t true_count = 0;
+	idx_t false_count = 0;
+	for (idx_t i = 0; i < keys.size(); i++) {
+		const auto partition_idx = (hashes_ptr[hashes_data.sel->get_index(i)] & mask) >> shift;
+		if (current_partitions[partition_idx]) {
+			true_sel.set_index(true_count++, i);
+		} else {
+			false_sel.set_index(false_count++, i);
+		}
+	}
 
 	CreateSpillChunk(spill_chunk, keys, payload, hashes);
 
@@ -1559,22 +1700,51 @@ void ProbeSpill::Finalize() {
 	local_partition_append_states.clear();
 }
 
+void ProbeSpill::Repartition(const idx_t added_bits, const vector<bool> &split_partitions) {
+	auto &old_partitions = global_partitions->GetPartitions();
+	auto new_global_partitions =
+	    make_uniq<RadixPartitionedColumnData>(context, probe_types, ht.radix_bits, probe_types.size() - 1);
+	auto new_partitions = new_global_partitions->CreateShared();
+
+	// Split the partitions that do not fit by themselves
+	PartitionedColumnDataAppendState append_state;
+	new_partitions->InitializeAppendState(append_state);
+	for (idx_t partition_idx = 0; partition_idx < old_partitions.size(); partition_idx++) {
+		if (!split_partitions[partition_idx] || !old_partitions[partition_idx]) {
+			continue;
+		}
+		for (auto &chunk : old_partitions[partition_idx]->Chunks()) {
+			new_partitions->Append(append_state, chunk);
+		}
+		old_partitions[partition_idx].reset();
+	}
+	new_partitions->FlushAppendState(append_state);
+
+	// Move the other partitions to the first of their new partitions
+	const auto multiplier = RadixPartitioning::NumberOfPartitions(added_bits);
+	auto &partitions = new_partitions->GetPartitions();
+	for (idx_t partition_idx = 0; partition_idx < old_partitions.size(); partition_idx++) {
+		if (old_partitions[partition_idx]) {
+			partitions[partition_idx * multiplier] = std::move(old_partitions[partition_idx]);
+		}
+	}
+	new_global_partitions->Combine(*new_partitions);
+	global_partitions = std::move(new_global_partitions);
+}
+
 void ProbeSpill::PrepareNextProbe() {
+	// Move the partitions of the current round to the global spill collection
+	global_spill_collection = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), probe_types);
 	auto &partitions = global_partitions->GetPartitions();
-	if (partitions.empty() || ht.partition_start == partitions.size()) {
-		// Can't probe, just make an empty one
-		global_spill_collection =
-		    make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), probe_types);
-	} else {
-		// Move specific partitions to the global spill collection
-		global_spill_collection = std::move(partitions[ht.partition_start]);
-		for (idx_t i = ht.partition_start + 1; i < ht.partition_end; i++) {
-			auto &partition = partitions[i];
-			if (global_spill_collection->Count() == 0) {
-				global_spill_collection = std::move(partition);
-			} else {
-				global_spill_collection->Combine(*partition);
-			}
+	for (idx_t partition_idx = 0; partition_idx < partitions.size(); partition_idx++) {
+		auto &partition = partitions[partition_idx];
+		if (!ht.IsCurrentPartition(partition_idx) || !partition) {
+			continue;
+		}
+		if (global_spill_collection->Count() == 0) {
+			global_spill_collection = std::move(partition);
+		} else {
+			global_spill_collection->Combine(*partition);
 		}
 	}
 	consumer = make_uniq<ColumnDataConsumer>(*global_spill_collection, column_ids);
@@ -14,7 +14,9 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -560,7 +562,57 @@ public:
 	}
 };
 
-void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+void JoinFilterPushdownInfo::PushKeyFilters(JoinHashTable &ht, const vector<idx_t> &filter_indexes,
+                                            const PhysicalOperator &op) const {
+	auto &data_collection = ht.GetDataCollection();
+	auto &layout_types = data_collection.GetLayout().GetTypes();
+
+	// small build sides are pushed as an exact IN filter, larger build sides as a bloom filter
+	vector<column_t> key_columns;
+	vector<bool> use_in_filter;
+	vector<vector<Value>> in_values;
+	vector<unique_ptr<BloomFilter>> bloom_filters;
+	for (auto &filter_idx : filter_indexes) {
+		auto join_condition = filters[filter_idx].join_condition;
+		auto &key_type = layout_types[join_condition];
+		key_columns.push_back(join_condition);
+		use_in_filter.push_back(ht.Count() <= MAX_IN_FILTER_KEYS && InFilter::SupportsType(key_type));
+		in_values.emplace_back();
+		bloom_filters.push_back(use_in_filter.back() ? nullptr : make_uniq<BloomFilter>(key_type, ht.Count()));
+	}
+
+	// scan the keys of the build side once
+	TupleDataScanState scan_state;
+	data_collection.InitializeScan(scan_state, key_columns, TupleDataPinProperties::UNPIN_AFTER_DONE);
+	DataChunk keys;
+	data_collection.InitializeScanChunk(scan_state, keys);
+	while (data_collection.Scan(scan_state, keys)) {
+		for (idx_t col_idx = 0; col_idx < key_columns.size(); col_idx++) {
+			if (!use_in_filter[col_idx]) {
+				bloom_filters[col_idx]->Insert(keys.data[col_idx], keys.size());
+				continue;
+			}
+			for (idx_t i = 0; i < keys.size(); i++) {
+				auto value = keys.data[col_idx].GetValue(i);
+				if (!value.IsNull()) {
+					in_values[col_idx].push_back(std::move(value));
+				}
+			}
+		}
+	}
+
+	for (idx_t i = 0; i < filter_indexes.size(); i++) {
+		auto filter_col_idx = filters[filter_indexes[i]].probe_column_index.column_index;
+		if (!use_in_filter[i]) {
+			dynamic_filters->PushFilter(op, filter_col_idx, std::move(bloom_filters[i]));
+		} else if (!in_values[i].empty()) {
+			dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<InFilter>(std::move(in_values[i])));
+		}
+	}
+}
+
+void JoinFilterPushdownInfo::PushFilters(JoinHashTable &ht, JoinFilterGlobalState &gstate,
+                                         const PhysicalOperator &op) const {
 	// finalize the min/max aggregates
 	vector<LogicalType> min_max_types;
 	for (auto &aggr_expr : min_max_aggregates) {
@@ -572,6 +624,7 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 	gstate.global_aggregate_state->Finalize(final_min_max);
 
 	// create a filter for each of the aggregates
+	vector<idx_t> key_filter_indexes;
 	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
 		auto &filter = filters[filter_idx];
 		auto filter_col_idx = filter.probe_column_index.column_index;
@@ -597,10 +650,20 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(greater_equals));
 			auto less_equals = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val));
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(less_equals));
+			// the range might still contain many values that are not in the build side - filter on the keys as well
+			key_filter_indexes.push_back(filter_idx);
 		}
 		// not null filter
 		dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<IsNotNullFilter>());
 	}
+	// IN filters are cheap to create and evaluate, bloom filters only pay off if the build side is (much) smaller than
+	// the probe side - as they are built with a single pass over the build side, we also limit their size
+	auto build_count = ht.Count();
+	auto probe_cardinality = op.children[0]->estimated_cardinality;
+	if (!key_filter_indexes.empty() && (build_count <= MAX_IN_FILTER_KEYS ||
+	                                    (build_count < probe_cardinality && build_count <= MAX_BLOOM_FILTER_KEYS))) {
+		PushKeyFilters(ht, key_filter_indexes, op);
+	}
 }
 
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
@@ -646,7 +709,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	ht.Unpartition();
 
 	if (filter_pushdown && ht.Count() > 0) {
-		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+		filter_pushdown->PushFilters(ht, *sink.global_filter_state, *this);
 	}
 
 	// check for possible perfect hash table
@@ -951,7 +1014,8 @@ void HashJoinGlobalSourceState::PrepareBuild(HashJoinGlobalSinkState &sink) {
 	sink.temporary_memory_state->SetRemainingSizeAndUpdateReservation(sink.context, ht.GetRemainingSize());
 
 	// Try to put the next partitions in the block collection of the HT
-	if (!sink.external || !ht.PrepareExternalFinalize(sink.temporary_memory_state->GetReservation())) {
+	if (!sink.external ||
+	    !ht.PrepareExternalFinalize(sink.temporary_memory_state->GetReservation(), sink.probe_spill.get())) {
 		global_stage = HashJoinSourceStage::DONE;
 		sink.temporary_memory_state->SetZero();
 		return;
@@ -1215,11 +1279,11 @@ double PhysicalHashJoin::GetProgress(ClientContext &context, GlobalSourceState &
 	}
 
 	auto num_partitions = static_cast<double>(RadixPartitioning::NumberOfPartitions(sink.hash_table->GetRadixBits()));
-	auto partition_start = static_cast<double>(sink.hash_table->GetPartitionStart());
-	auto partition_end = static_cast<double>(sink.hash_table->GetPartitionEnd());
+	auto completed_partitions = static_cast<double>(sink.hash_table->GetCompletedPartitionCount());
+	auto current_partitions = static_cast<double>(sink.hash_table->GetCurrentPartitionCount());
 
 	// This many partitions are fully done
-	auto progress = partition_start / num_partitions;
+	auto progress = completed_partitions / num_partitions;
 
 	auto probe_chunk_done = static_cast<double>(gstate.probe_chunk_done);
 	auto probe_chunk_count = static_cast<double>(gstate.probe_chunk_count);
@@ -1227,7 +1291,7 @@ double PhysicalHashJoin::GetProgress(ClientContext &context, GlobalSourceState &
 		// Progress of the current round of probing, weighed by the number of partitions
 		auto probe_progress = probe_chunk_done / probe_chunk_count;
 		// Add it to the progress, weighed by the number of partitions in the current round
-		progress += (partition_end - partition_start) / num_partitions * probe_progress;
+		progress += current_partitions / num_partitions * probe_progress;
 	}
 
 	return progress * 100.0;
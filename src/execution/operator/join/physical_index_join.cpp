@@ -0,0 +1,407 @@
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/art_key.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+static column_t GetStorageIndex(TableCatalogEntry &table, column_t column_id) {
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return column_id;
+	}
+	return table.GetColumn(LogicalIndex(column_id)).StorageOid();
+}
+
+static column_t GetStorageIndex(const PhysicalTableScan &scan, TableCatalogEntry &table, idx_t scan_column) {
+	auto column_id = scan.column_ids[scan.projection_ids.empty() ? scan_column : scan.projection_ids[scan_column]];
+	return GetStorageIndex(table, column_id);
+}
+
+PhysicalIndexJoin::PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> probe,
+                                     unique_ptr<PhysicalOperator> table_scan, vector<JoinCondition> cond,
+                                     JoinType join_type, const vector<idx_t> &left_projection_map,
+                                     const vector<idx_t> &right_projection_map, string index_name_p,
+                                     bool index_on_left_p, unique_ptr<Expression> residual_filter,
+                                     idx_t estimated_cardinality)
+    : PhysicalComparisonJoin(op, PhysicalOperatorType::INDEX_JOIN, std::move(cond), join_type, estimated_cardinality),
+      index_name(std::move(index_name_p)), index_on_left(index_on_left_p) {
+	D_ASSERT(join_type == JoinType::INNER);
+	children.push_back(std::move(probe));
+	children.push_back(std::move(table_scan));
+
+	auto &scan = children[1]->Cast<PhysicalTableScan>();
+	auto &table = GetTable();
+
+	// The probe columns in the output
+	probe_projection_map = index_on_left ? right_projection_map : left_projection_map;
+	if (probe_projection_map.empty()) {
+		for (idx_t i = 0; i < children[0]->types.size(); i++) {
+			probe_projection_map.push_back(i);
+		}
+	}
+
+	// The table columns in the output
+	auto &table_projection_map = index_on_left ? left_projection_map : right_projection_map;
+	auto table_column_count = table_projection_map.empty() ? scan.types.size() : table_projection_map.size();
+	if (residual_filter) {
+		// The residual filter references the columns of the scan, so we fetch all of them
+		for (idx_t i = 0; i < scan.types.size(); i++) {
+			fetch_ids.push_back(GetStorageIndex(scan, table, i));
+			fetch_types.push_back(scan.types[i]);
+		}
+		for (idx_t i = 0; i < table_column_count; i++) {
+			table_output_map.push_back(table_projection_map.empty() ? i : table_projection_map[i]);
+		}
+	} else {
+		for (idx_t i = 0; i < table_column_count; i++) {
+			auto scan_column = table_projection_map.empty() ? i : table_projection_map[i];
+			fetch_ids.push_back(GetStorageIndex(scan, table, scan_column));
+			fetch_types.push_back(scan.types[scan_column]);
+			table_output_map.push_back(i);
+		}
+	}
+	// The table filters of the scan (e.g. the min/max filters added by the statistics propagation) are evaluated on
+	// the fetched rows, we fetch the filtered columns after the output columns
+	vector<unique_ptr<Expression>> filters;
+	if (residual_filter) {
+		filters.push_back(std::move(residual_filter));
+	}
+	if (scan.table_filters) {
+		for (auto &entry : scan.table_filters->filters) {
+			auto column_id = scan.column_ids[entry.first];
+			auto column_type = column_id == COLUMN_IDENTIFIER_ROW_ID ? LogicalType(LogicalType::ROW_TYPE)
+			                                                         : scan.returned_types[column_id];
+			BoundReferenceExpression column(column_type, fetch_ids.size());
+			filters.push_back(entry.second->ToExpression(column));
+			fetch_ids.push_back(GetStorageIndex(table, column_id));
+			fetch_types.push_back(std::move(column_type));
+		}
+	}
+	if (filters.size() == 1) {
+		table_filter = std::move(filters[0]);
+	} else if (filters.size() > 1) {
+		auto conjunction = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND);
+		conjunction->children = std::move(filters);
+		table_filter = std::move(conjunction);
+	}
+	// We always fetch the row IDs to match the fetched rows with the probe rows
+	fetch_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	fetch_types.push_back(LogicalType::ROW_TYPE);
+
+	// The conditions are in the order of the index columns
+	for (auto &condition : conditions) {
+		auto &table_key = index_on_left ? *condition.left : *condition.right;
+		auto &key_ref = table_key.Cast<BoundReferenceExpression>();
+		key_ids.push_back(GetStorageIndex(scan, table, key_ref.index));
+		key_types.push_back(key_ref.return_type);
+	}
+}
+
+DuckTableEntry &PhysicalIndexJoin::GetTable() const {
+	auto &scan = children[1]->Cast<PhysicalTableScan>();
+	return scan.bind_data->Cast<TableScanBindData>().table;
+}
+
+InsertionOrderPreservingMap<string> PhysicalIndexJoin::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	result["Join Type"] = EnumUtil::ToString(join_type);
+	string condition_info;
+	for (idx_t i = 0; i < conditions.size(); i++) {
+		auto &join_condition = conditions[i];
+		if (i > 0) {
+			condition_info += "\n";
+		}
+		condition_info +=
+		    StringUtil::Format("%s %s %s", join_condition.left->GetName(),
+		                       ExpressionTypeToOperator(join_condition.comparison), join_condition.right->GetName());
+	}
+	result["Conditions"] = condition_info;
+	result["Table"] = GetTable().name;
+	result["Index"] = index_name;
+	if (table_filter) {
+		result["Filters"] = table_filter->GetName();
+	}
+	SetEstimatedCardinality(result, estimated_cardinality);
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Operator
+//===--------------------------------------------------------------------===//
+class IndexJoinGlobalState : public GlobalOperatorState {
+public:
+	IndexJoinGlobalState(ClientContext &context, const PhysicalIndexJoin &op)
+	    : table(op.GetTable()), storage(table.GetStorage()),
+	      transaction(DuckTransaction::Get(context, table.catalog)) {
+		auto &info = *storage.GetDataTableInfo();
+		// Prevent checkpoints from moving rows while we hold on to row IDs
+		checkpoint_lock = transaction.SharedLockTable(info);
+		info.GetIndexes().BindAndScan<ART>(context, info, [&](ART &index) {
+			if (index.GetIndexName() == op.index_name) {
+				art = index;
+				return true;
+			}
+			return false;
+		});
+		if (!art) {
+			throw InternalException("Index \"%s\" of the index join not found", op.index_name);
+		}
+		InitializeLocalRows(context, op);
+	}
+
+	DuckTableEntry &table;
+	DataTable &storage;
+	DuckTransaction &transaction;
+	shared_ptr<CheckpointLock> checkpoint_lock;
+	optional_ptr<ART> art;
+	//! The transaction-local rows are not in the ART yet, so we look them up by their key
+	unordered_map<string, unsafe_vector<row_t>> local_rows;
+
+private:
+	void InitializeLocalRows(ClientContext &context, const PhysicalIndexJoin &op) {
+		auto &local_storage = LocalStorage::Get(transaction);
+		if (local_storage.AddedRows(storage) == 0) {
+			return;
+		}
+
+		vector<storage_t> scan_ids = op.key_ids;
+		scan_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+		auto scan_types = op.key_types;
+		scan_types.push_back(LogicalType::ROW_TYPE);
+
+		TableScanState scan_state;
+		scan_state.Initialize(scan_ids);
+		local_storage.InitializeScan(storage, scan_state.local_state, nullptr);
+
+		auto &allocator = Allocator::Get(context);
+		DataChunk scan_chunk;
+		scan_chunk.Initialize(allocator, scan_types);
+		DataChunk key_chunk;
+		key_chunk.InitializeEmpty(op.key_types);
+
+		ArenaAllocator arena(allocator);
+		unsafe_vector<ARTKey> keys(STANDARD_VECTOR_SIZE);
+		while (true) {
+			scan_chunk.Reset();
+			local_storage.Scan(scan_state.local_state, scan_ids, scan_chunk);
+			if (scan_chunk.size() == 0) {
+				break;
+			}
+			for (idx_t i = 0; i < op.key_types.size(); i++) {
+				key_chunk.data[i].Reference(scan_chunk.data[i]);
+			}
+			key_chunk.SetCardinality(scan_chunk);
+
+			arena.Reset();
+			ART::GenerateKeys<>(arena, key_chunk, keys);
+			auto &row_id_vector = scan_chunk.data[op.key_types.size()];
+			row_id_vector.Flatten(scan_chunk.size());
+			auto row_ids = FlatVector::GetData<row_t>(row_id_vector);
+			for (idx_t i = 0; i < scan_chunk.size(); i++) {
+				if (keys[i].Empty()) {
+					continue;
+				}
+				string key(const_char_ptr_cast(keys[i].data), keys[i].len);
+				local_rows[key].push_back(row_ids[i]);
+			}
+		}
+	}
+};
+
+class IndexJoinOperatorState : public CachingOperatorState {
+public:
+	IndexJoinOperatorState(ExecutionContext &context, const PhysicalIndexJoin &op)
+	    : probe_executor(context.client), arena(Allocator::Get(context.client)), keys(STANDARD_VECTOR_SIZE),
+	      probe_sel(STANDARD_VECTOR_SIZE), filter_executor(context.client), filter_sel(STANDARD_VECTOR_SIZE) {
+		vector<LogicalType> condition_types;
+		for (auto &cond : op.conditions) {
+			auto &probe_key = op.index_on_left ? *cond.right : *cond.left;
+			probe_executor.AddExpression(probe_key);
+			condition_types.push_back(probe_key.return_type);
+		}
+		auto &allocator = Allocator::Get(context.client);
+		join_keys.Initialize(allocator, condition_types);
+		fetch_chunk.Initialize(allocator, op.fetch_types);
+		if (op.table_filter) {
+			filter_executor.AddExpression(*op.table_filter);
+		}
+	}
+
+	//! Evaluates the join keys of the probe side
+	ExpressionExecutor probe_executor;
+	DataChunk join_keys;
+	ArenaAllocator arena;
+	unsafe_vector<ARTKey> keys;
+
+	//! Whether or not we already looked up the current input chunk
+	bool probed = false;
+	//! The matches of the current input chunk: the probe rows and the row IDs of the table
+	unsafe_vector<sel_t> match_sel;
+	unsafe_vector<row_t> match_row_ids;
+	unsafe_vector<idx_t> offsets;
+	idx_t match_offset = 0;
+
+	DataChunk fetch_chunk;
+	ColumnFetchState fetch_state;
+	SelectionVector probe_sel;
+
+	//! Evaluates the table filters on the fetched rows
+	ExpressionExecutor filter_executor;
+	SelectionVector filter_sel;
+
+public:
+	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
+		context.thread.profiler.Flush(op);
+	}
+};
+
+unique_ptr<GlobalOperatorState> PhysicalIndexJoin::GetGlobalOperatorState(ClientContext &context) const {
+	return make_uniq<IndexJoinGlobalState>(context, *this);
+}
+
+unique_ptr<OperatorState> PhysicalIndexJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<IndexJoinOperatorState>(context, *this);
+}
+
+static void LookupKeys(DataChunk &input, IndexJoinGlobalState &gstate, IndexJoinOperatorState &state) {
+	state.join_keys.Reset();
+	state.probe_executor.Execute(input, state.join_keys);
+
+	state.arena.Reset();
+	ART::GenerateKeys<>(state.arena, state.join_keys, state.keys);
+	gstate.art->SearchEqualJoin(state.keys, input.size(), state.match_row_ids, state.offsets);
+
+	state.match_sel.clear();
+	for (idx_t i = 0; i < input.size(); i++) {
+		for (idx_t offset = state.offsets[i]; offset < state.offsets[i + 1]; offset++) {
+			state.match_sel.push_back(UnsafeNumericCast<sel_t>(i));
+		}
+	}
+
+	// The transaction-local matches follow the matches in the ART
+	if (gstate.local_rows.empty()) {
+		return;
+	}
+	for (idx_t i = 0; i < input.size(); i++) {
+		auto &key = state.keys[i];
+		if (key.Empty()) {
+			continue;
+		}
+		auto entry = gstate.local_rows.find(string(const_char_ptr_cast(key.data), key.len));
+		if (entry == gstate.local_rows.end()) {
+			continue;
+		}
+		for (auto &row_id : entry->second) {
+			state.match_sel.push_back(UnsafeNumericCast<sel_t>(i));
+			state.match_row_ids.push_back(row_id);
+		}
+	}
+}
+
+OperatorResultType PhysicalIndexJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                      GlobalOperatorState &gstate_p, OperatorState &state_p) const {
+	auto &gstate = gstate_p.Cast<IndexJoinGlobalState>();
+	auto &state = state_p.Cast<IndexJoinOperatorState>();
+
+	if (!state.probed) {
+		LookupKeys(input, gstate, state);
+		state.probed = true;
+		state.match_offset = 0;
+	}
+
+	auto match_count = state.match_row_ids.size();
+	while (state.match_offset < match_count) {
+		// Fetch the next batch of matches, either only from the table or only from the transaction-local storage
+		auto start = state.match_offset;
+		auto is_local = state.match_row_ids[start] >= MAX_ROW_ID;
+		auto end = start;
+		while (end < match_count && end - start < STANDARD_VECTOR_SIZE &&
+		       (state.match_row_ids[end] >= MAX_ROW_ID) == is_local) {
+			end++;
+		}
+		state.match_offset = end;
+
+		auto fetch_count = end - start;
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(&state.match_row_ids[start]));
+		state.fetch_chunk.Reset();
+		if (is_local) {
+			auto &local_storage = LocalStorage::Get(gstate.transaction);
+			local_storage.FetchChunk(gstate.storage, row_ids, fetch_count, fetch_ids, state.fetch_chunk,
+			                         state.fetch_state);
+		} else {
+			gstate.storage.Fetch(gstate.transaction, state.fetch_chunk, fetch_ids, row_ids, fetch_count,
+			                     state.fetch_state);
+		}
+		if (state.fetch_chunk.size() == 0) {
+			continue;
+		}
+
+		// Rows that are not visible to this transaction are skipped by the fetch, but the fetched rows keep their
+		// order. We match them with the probe rows through their row IDs.
+		auto fetched_row_ids = FlatVector::GetData<row_t>(state.fetch_chunk.data.back());
+		auto match_idx = start;
+		for (idx_t i = 0; i < state.fetch_chunk.size(); i++) {
+			while (state.match_row_ids[match_idx] != fetched_row_ids[i]) {
+				match_idx++;
+			}
+			D_ASSERT(match_idx < end);
+			state.probe_sel.set_index(i, state.match_sel[match_idx]);
+			match_idx++;
+		}
+
+		// Remove the fetched rows that do not pass the table filters
+		if (table_filter) {
+			auto filter_count = state.filter_executor.SelectExpression(state.fetch_chunk, state.filter_sel);
+			if (filter_count == 0) {
+				continue;
+			}
+			if (filter_count < state.fetch_chunk.size()) {
+				for (idx_t i = 0; i < filter_count; i++) {
+					state.probe_sel.set_index(i, state.probe_sel.get_index(state.filter_sel.get_index(i)));
+				}
+				state.fetch_chunk.Slice(state.filter_sel, filter_count);
+			}
+		}
+
+		// Construct the result
+		auto table_column_count = table_output_map.size();
+		auto probe_offset = index_on_left ? table_column_count : 0;
+		auto table_offset = index_on_left ? 0 : probe_projection_map.size();
+		for (idx_t i = 0; i < probe_projection_map.size(); i++) {
+			chunk.data[probe_offset + i].Slice(input.data[probe_projection_map[i]], state.probe_sel,
+			                                   state.fetch_chunk.size());
+		}
+		for (idx_t i = 0; i < table_column_count; i++) {
+			chunk.data[table_offset + i].Reference(state.fetch_chunk.data[table_output_map[i]]);
+		}
+		chunk.SetCardinality(state.fetch_chunk.size());
+
+		if (state.match_offset < match_count) {
+			return OperatorResultType::HAVE_MORE_OUTPUT;
+		}
+		break;
+	}
+	state.probed = false;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+//===--------------------------------------------------------------------===//
+// Pipeline Construction
+//===--------------------------------------------------------------------===//
+void PhysicalIndexJoin::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
+	// The table side is not scanned, we only build the probe side
+	PhysicalJoin::BuildJoinPipelines(current, meta_pipeline, *this, false);
+}
+
+} // namespace duckdb
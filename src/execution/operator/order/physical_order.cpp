@@ -160,8 +160,8 @@ public:
 		auto &global_sort_state = gstate.global_sort_state;
 
 		global_sort_state.CompleteMergeRound();
-		if (global_sort_state.sorted_blocks.size() > 1) {
-			// Multiple blocks remaining: Schedule the next round
+		if (!global_sort_state.IsFinalMergeRound()) {
+			// Too many blocks remaining: Schedule the next round
 			PhysicalOrder::ScheduleMergeTasks(*pipeline, *this, gstate);
 		}
 	}
@@ -180,8 +180,8 @@ SinkFinalizeType PhysicalOrder::Finalize(Pipeline &pipeline, Event &event, Clien
 	// Prepare for merge sort phase
 	global_sort_state.PrepareMergePhase();
 
-	// Start the merge phase or finish if a merge is not necessary
-	if (global_sort_state.sorted_blocks.size() > 1) {
+	// Start the merge phase or finish if the remaining blocks can be merged while scanning
+	if (!global_sort_state.IsFinalMergeRound()) {
 		PhysicalOrder::ScheduleMergeTasks(pipeline, event, state);
 	}
 	return SinkFinalizeType::READY;
@@ -199,13 +199,22 @@ void PhysicalOrder::ScheduleMergeTasks(Pipeline &pipeline, Event &event, OrderGl
 //===--------------------------------------------------------------------===//
 class PhysicalOrderGlobalSourceState : public GlobalSourceState {
 public:
-	explicit PhysicalOrderGlobalSourceState(OrderGlobalSinkState &sink) : next_batch_index(0) {
+	explicit PhysicalOrderGlobalSourceState(OrderGlobalSinkState &sink) : next_batch_index(0), merge(false) {
 		auto &global_sort_state = sink.global_sort_state;
 		if (global_sort_state.sorted_blocks.empty()) {
 			total_batches = 0;
-		} else {
-			D_ASSERT(global_sort_state.sorted_blocks.size() == 1);
+		} else if (global_sort_state.sorted_blocks.size() == 1) {
 			total_batches = global_sort_state.sorted_blocks[0]->payload_data->data_blocks.size();
+		} else {
+			// The final round of the merge is done while scanning, every partition of the merge is a batch
+			D_ASSERT(global_sort_state.IsFinalMergeRound());
+			idx_t count = 0;
+			for (auto &sorted_block : global_sort_state.sorted_blocks) {
+				count += sorted_block->Count();
+			}
+			global_sort_state.InitializeMergeRound();
+			total_batches = (count + global_sort_state.block_capacity - 1) / global_sort_state.block_capacity;
+			merge = true;
 		}
 	}
 
@@ -216,6 +225,8 @@ public:
 public:
 	atomic<idx_t> next_batch_index;
 	idx_t total_batches;
+	//! Whether the sorted blocks are merged while scanning
+	bool merge;
 };
 
 unique_ptr<GlobalSourceState> PhysicalOrder::GetGlobalSourceState(ClientContext &context) const {
@@ -226,12 +237,14 @@ unique_ptr<GlobalSourceState> PhysicalOrder::GetGlobalSourceState(ClientContext
 class PhysicalOrderLocalSourceState : public LocalSourceState {
 public:
 	explicit PhysicalOrderLocalSourceState(PhysicalOrderGlobalSourceState &gstate)
-	    : batch_index(gstate.next_batch_index++) {
+	    : batch_index(gstate.merge ? 0 : gstate.next_batch_index++) {
 	}
 
 public:
 	idx_t batch_index;
 	unique_ptr<PayloadScanner> scanner;
+	//! Merges the next partition of the sorted blocks (if merging while scanning)
+	unique_ptr<MergeSorter> merge_sorter;
 };
 
 unique_ptr<LocalSourceState> PhysicalOrder::GetLocalSourceState(ExecutionContext &context,
@@ -243,6 +256,26 @@ unique_ptr<LocalSourceState> PhysicalOrder::GetLocalSourceState(ExecutionContext
 SourceResultType PhysicalOrder::GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const {
 	auto &gstate = input.global_state.Cast<PhysicalOrderGlobalSourceState>();
 	auto &lstate = input.local_state.Cast<PhysicalOrderLocalSourceState>();
+	auto &sink = this->sink_state->Cast<OrderGlobalSinkState>();
+	auto &global_sort_state = sink.global_sort_state;
+
+	if (gstate.merge) {
+		// Merge the next partition into a block, and scan it straight away
+		if (!lstate.scanner || lstate.scanner->Remaining() == 0) {
+			lstate.scanner = nullptr;
+			if (!lstate.merge_sorter) {
+				lstate.merge_sorter =
+				    make_uniq<MergeSorter>(global_sort_state, BufferManager::GetBufferManager(context.client));
+			}
+			auto sorted_block = lstate.merge_sorter->MergeNextPayloadPartition(lstate.batch_index);
+			if (!sorted_block) {
+				return SourceResultType::FINISHED;
+			}
+			lstate.scanner = make_uniq<PayloadScanner>(*sorted_block->payload_data, global_sort_state, true);
+		}
+		lstate.scanner->Scan(chunk);
+		return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
+	}
 
 	if (lstate.scanner && lstate.scanner->Remaining() == 0) {
 		lstate.batch_index = gstate.next_batch_index++;
@@ -254,8 +287,6 @@ SourceResultType PhysicalOrder::GetData(ExecutionContext &context, DataChunk &ch
 	}
 
 	if (!lstate.scanner) {
-		auto &sink = this->sink_state->Cast<OrderGlobalSinkState>();
-		auto &global_sort_state = sink.global_sort_state;
 		lstate.scanner = make_uniq<PayloadScanner>(global_sort_state, lstate.batch_index, true);
 	}
 
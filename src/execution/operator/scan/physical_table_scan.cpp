@@ -134,6 +134,23 @@ string PhysicalTableScan::GetName() const {
 	return StringUtil::Upper(function.name + " " + function.extra_info);
 }
 
+string PhysicalTableScan::FiltersToString(const TableFilterSet &filters) const {
+	string filters_info;
+	bool first_item = true;
+	for (auto &f : filters.filters) {
+		auto &column_index = f.first;
+		auto &filter = f.second;
+		if (column_index < names.size()) {
+			if (!first_item) {
+				filters_info += "\n";
+			}
+			first_item = false;
+			filters_info += filter->ToString(names[column_ids[column_index]]);
+		}
+	}
+	return filters_info;
+}
+
 InsertionOrderPreservingMap<string> PhysicalTableScan::ParamsToString() const {
 	InsertionOrderPreservingMap<string> result;
 	if (function.to_string) {
@@ -169,20 +186,14 @@ InsertionOrderPreservingMap<string> PhysicalTableScan::ParamsToString() const {
 		}
 	}
 	if (function.filter_pushdown && table_filters) {
-		string filters_info;
-		bool first_item = true;
-		for (auto &f : table_filters->filters) {
-			auto &column_index = f.first;
-			auto &filter = f.second;
-			if (column_index < names.size()) {
-				if (!first_item) {
-					filters_info += "\n";
-				}
-				first_item = false;
-				filters_info += filter->ToString(names[column_ids[column_index]]);
-			}
+		result["Filters"] = FiltersToString(*table_filters);
+	}
+	if (function.filter_pushdown && dynamic_filters && dynamic_filters->HasFilters()) {
+		// the filters pushed by joins are only known once their build side is finished
+		auto final_filters = dynamic_filters->GetFinalTableFilters(*this, nullptr);
+		if (final_filters) {
+			result["Dynamic Filters"] = FiltersToString(*final_filters);
 		}
-		result["Filters"] = filters_info;
 	}
 	if (!extra_info.file_filters.empty()) {
 		result["File Filters"] = extra_info.file_filters;
@@ -7,6 +7,8 @@
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
@@ -16,10 +18,10 @@ namespace duckdb {
 PhysicalCreateARTIndex::PhysicalCreateARTIndex(LogicalOperator &op, TableCatalogEntry &table_p,
                                                const vector<column_t> &column_ids, unique_ptr<CreateIndexInfo> info,
                                                vector<unique_ptr<Expression>> unbound_expressions,
-                                               idx_t estimated_cardinality, const bool sorted)
+                                               idx_t estimated_cardinality)
     : PhysicalOperator(PhysicalOperatorType::CREATE_INDEX, op.types, estimated_cardinality),
-      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)), unbound_expressions(std::move(unbound_expressions)),
-      sorted(sorted) {
+      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)),
+      unbound_expressions(std::move(unbound_expressions)) {
 
 	// Convert the virtual column ids to physical column ids.
 	for (auto &column_id : column_ids) {
@@ -27,6 +29,91 @@ PhysicalCreateARTIndex::PhysicalCreateARTIndex(LogicalOperator &op, TableCatalog
 	}
 }
 
+unique_ptr<ART> PhysicalCreateARTIndex::CreateART(optional_ptr<ART> shared_allocators) const {
+	auto &storage = table.GetStorage();
+	if (shared_allocators) {
+		return make_uniq<ART>(info->index_name, info->constraint_type, storage_ids, TableIOManager::Get(storage),
+		                      unbound_expressions, storage.db, shared_allocators->allocators);
+	}
+	return make_uniq<ART>(info->index_name, info->constraint_type, storage_ids, TableIOManager::Get(storage),
+	                      unbound_expressions, storage.db);
+}
+
+//===--------------------------------------------------------------------===//
+// Bulk Loading
+//===--------------------------------------------------------------------===//
+
+//! The buffered keys and row IDs of a thread.
+struct ARTBuildRun {
+	explicit ARTBuildRun(Allocator &allocator) : arena_allocator(allocator) {
+	}
+
+	//! Holds the key bytes.
+	ArenaAllocator arena_allocator;
+	unsafe_vector<ARTKey> keys;
+	unsafe_vector<ARTKey> row_ids;
+
+public:
+	idx_t SizeInBytes() const {
+		return arena_allocator.SizeInBytes() + (keys.capacity() + row_ids.capacity()) * sizeof(ARTKey);
+	}
+	void Reset() {
+		arena_allocator.Reset();
+		keys.clear();
+		row_ids.clear();
+	}
+};
+
+//! A partition of the parallel bulk-load. All its keys have the same byte after the common prefix of all keys,
+//! i.e., the ARTs of different partitions are disjoint subtrees.
+struct ARTBuildPartition {
+	unsafe_vector<ARTKey> keys;
+	unsafe_vector<ARTKey> row_ids;
+	unique_ptr<ART> art;
+};
+
+static bool KeyLessThan(const ARTKey &left, const ARTKey &right) {
+	auto cmp = memcmp(left.data, right.data, MinValue(left.len, right.len));
+	if (cmp != 0) {
+		return cmp < 0;
+	}
+	return left.len < right.len;
+}
+
+//! Sorts the keys (and their row IDs), and constructs the ART bottom-up from the sorted keys.
+static void BulkLoad(ART &art, unsafe_vector<ARTKey> &keys, unsafe_vector<ARTKey> &row_ids) {
+	D_ASSERT(keys.size() == row_ids.size());
+	if (keys.empty()) {
+		return;
+	}
+
+	// We sort duplicate keys by their row IDs.
+	unsafe_vector<idx_t> order(keys.size());
+	for (idx_t i = 0; i < order.size(); i++) {
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), [&](const idx_t a, const idx_t b) {
+		if (KeyLessThan(keys[a], keys[b])) {
+			return true;
+		}
+		if (KeyLessThan(keys[b], keys[a])) {
+			return false;
+		}
+		return KeyLessThan(row_ids[a], row_ids[b]);
+	});
+
+	unsafe_vector<ARTKey> sorted_keys(keys.size());
+	unsafe_vector<ARTKey> sorted_row_ids(keys.size());
+	for (idx_t i = 0; i < order.size(); i++) {
+		sorted_keys[i] = keys[order[i]];
+		sorted_row_ids[i] = row_ids[order[i]];
+	}
+
+	if (!art.Construct(sorted_keys, sorted_row_ids, sorted_keys.size())) {
+		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
@@ -34,123 +121,247 @@ PhysicalCreateARTIndex::PhysicalCreateARTIndex(LogicalOperator &op, TableCatalog
 class CreateARTIndexGlobalSinkState : public GlobalSinkState {
 public:
 	unique_ptr<BoundIndex> global_index;
+	//! The memory budget of each thread for buffering keys.
+	idx_t memory_per_thread;
+
+	mutex lock;
+	//! The buffered keys of all threads, which we bulk-load during Finalize.
+	vector<unique_ptr<ARTBuildRun>> runs;
+	//! The partitions of the bulk-load.
+	vector<ARTBuildPartition> partitions;
+	//! The next partition to construct.
+	atomic<idx_t> next_partition;
 };
 
 class CreateARTIndexLocalSinkState : public LocalSinkState {
 public:
-	explicit CreateARTIndexLocalSinkState(ClientContext &context) : arena_allocator(Allocator::Get(context)) {};
+	explicit CreateARTIndexLocalSinkState(ClientContext &context)
+	    : run(make_uniq<ARTBuildRun>(BufferAllocator::Get(context))) {};
 
+	//! Holds all keys that exceeded the memory budget of this thread.
 	unique_ptr<BoundIndex> local_index;
-	ArenaAllocator arena_allocator;
+	//! The buffered keys of this thread.
+	unique_ptr<ARTBuildRun> run;
 
 	DataChunk key_chunk;
 	unsafe_vector<ARTKey> keys;
 	vector<column_t> key_column_ids;
-
-	DataChunk row_id_chunk;
 	unsafe_vector<ARTKey> row_ids;
 };
 
 unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientContext &context) const {
 	// Create the global sink state and add the global index.
 	auto state = make_uniq<CreateARTIndexGlobalSinkState>();
-	auto &storage = table.GetStorage();
-	state->global_index = make_uniq<ART>(info->index_name, info->constraint_type, storage_ids,
-	                                     TableIOManager::Get(storage), unbound_expressions, storage.db);
+	state->global_index = CreateART();
+	state->memory_per_thread = GetMaxThreadMemory(context);
+	state->next_partition = 0;
 	return (std::move(state));
 }
 
 unique_ptr<LocalSinkState> PhysicalCreateARTIndex::GetLocalSinkState(ExecutionContext &context) const {
 	// Create the local sink state and add the local index.
 	auto state = make_uniq<CreateARTIndexLocalSinkState>(context.client);
-	auto &storage = table.GetStorage();
-	state->local_index = make_uniq<ART>(info->index_name, info->constraint_type, storage_ids,
-	                                    TableIOManager::Get(storage), unbound_expressions, storage.db);
+	state->local_index = CreateART();
 
 	// Initialize the local sink state.
 	state->keys.resize(STANDARD_VECTOR_SIZE);
 	state->row_ids.resize(STANDARD_VECTOR_SIZE);
 	state->key_chunk.Initialize(Allocator::Get(context.client), state->local_index->logical_types);
-	state->row_id_chunk.Initialize(Allocator::Get(context.client), vector<LogicalType> {LogicalType::ROW_TYPE});
 	for (idx_t i = 0; i < state->key_chunk.ColumnCount(); i++) {
 		state->key_column_ids.push_back(i);
 	}
 	return std::move(state);
 }
 
-SinkResultType PhysicalCreateARTIndex::SinkUnsorted(OperatorSinkInput &input) const {
+SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk &chunk,
+                                            OperatorSinkInput &input) const {
 
+	D_ASSERT(chunk.ColumnCount() >= 2);
+	auto &g_state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	auto row_count = l_state.key_chunk.size();
+	auto &run = *l_state.run;
 
-	// Insert each key and its corresponding row ID.
-	auto &art = l_state.local_index->Cast<ART>();
-	for (idx_t i = 0; i < row_count; i++) {
-		if (!art.Insert(art.tree, l_state.keys[i], 0, l_state.row_ids[i], art.tree.GetGateStatus())) {
-			throw ConstraintException("Data contains duplicates on indexed column(s)");
-		}
+	// Buffer the keys and row IDs of this chunk.
+	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
+	ART::GenerateKeyVectors(run.arena_allocator, l_state.key_chunk, chunk.data[chunk.ColumnCount() - 1], l_state.keys,
+	                        l_state.row_ids);
+	auto count = chunk.size();
+	run.keys.insert(run.keys.end(), l_state.keys.begin(), l_state.keys.begin() + NumericCast<int64_t>(count));
+	run.row_ids.insert(run.row_ids.end(), l_state.row_ids.begin(),
+	                   l_state.row_ids.begin() + NumericCast<int64_t>(count));
+
+	if (run.SizeInBytes() < g_state.memory_per_thread) {
+		return SinkResultType::NEED_MORE_INPUT;
 	}
 
+	// We exceeded the memory budget of this thread: we bulk-load the buffered keys into an ART,
+	// and merge it into the local ART.
+	auto art = CreateART(l_state.local_index->Cast<ART>());
+	BulkLoad(*art, run.keys, run.row_ids);
+	if (!l_state.local_index->MergeIndexes(*art)) {
+		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	}
+	run.Reset();
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
-SinkResultType PhysicalCreateARTIndex::SinkSorted(OperatorSinkInput &input) const {
+SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
+                                                      OperatorSinkCombineInput &input) const {
 
+	auto &g_state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	auto &storage = table.GetStorage();
-	auto &l_index = l_state.local_index;
 
-	// Construct an ART for this chunk.
-	auto art = make_uniq<ART>(info->index_name, l_index->GetConstraintType(), l_index->GetColumnIds(),
-	                          l_index->table_io_manager, l_index->unbound_expressions, storage.db,
-	                          l_index->Cast<ART>().allocators);
-	if (!art->Construct(l_state.keys, l_state.row_ids, l_state.key_chunk.size())) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	lock_guard<mutex> guard(g_state.lock);
+	if (!l_state.run->keys.empty()) {
+		g_state.runs.push_back(std::move(l_state.run));
 	}
 
-	// Merge the ART into the local ART.
-	if (!l_index->MergeIndexes(*art)) {
+	// Merge the keys that exceeded the memory budget into the global index.
+	auto &local_art = l_state.local_index->Cast<ART>();
+	if (local_art.tree.HasMetadata() && !g_state.global_index->MergeIndexes(local_art)) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
-
-	return SinkResultType::NEED_MORE_INPUT;
+	return SinkCombineResultType::FINISHED;
 }
 
-SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk &chunk,
-                                            OperatorSinkInput &input) const {
+//! Partitions the buffered keys by their first byte following the common prefix of all keys.
+static void PartitionKeys(CreateARTIndexGlobalSinkState &state) {
+	D_ASSERT(!state.runs.empty() && !state.runs[0]->keys.empty());
+	auto &first = state.runs[0]->keys[0];
+
+	// Find the common prefix of all keys.
+	auto depth = first.len;
+	for (auto &run : state.runs) {
+		for (auto &key : run->keys) {
+			idx_t i = 0;
+			while (i < depth && i < key.len && key[i] == first[i]) {
+				i++;
+			}
+			depth = i;
+		}
+	}
 
-	D_ASSERT(chunk.ColumnCount() >= 2);
-	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	l_state.arena_allocator.Reset();
-	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
-	ART::GenerateKeyVectors(l_state.arena_allocator, l_state.key_chunk, chunk.data[chunk.ColumnCount() - 1],
-	                        l_state.keys, l_state.row_ids);
+	// All keys are equal, e.g., for a non-unique index on a constant column.
+	// ART keys are prefix-free, so otherwise all keys have a byte following the common prefix.
+	idx_t partition_count = depth == first.len ? 1 : idx_t(NumericLimits<uint8_t>::Maximum()) + 1;
+	auto get_partition = [&](const ARTKey &key) -> idx_t {
+		return partition_count == 1 ? 0 : key[depth];
+	};
+
+	vector<idx_t> counts(partition_count, 0);
+	for (auto &run : state.runs) {
+		for (auto &key : run->keys) {
+			counts[get_partition(key)]++;
+		}
+	}
+	vector<idx_t> partition_map(partition_count);
+	for (idx_t i = 0; i < partition_count; i++) {
+		if (counts[i] == 0) {
+			continue;
+		}
+		partition_map[i] = state.partitions.size();
+		state.partitions.emplace_back();
+		state.partitions.back().keys.reserve(counts[i]);
+		state.partitions.back().row_ids.reserve(counts[i]);
+	}
 
-	if (sorted) {
-		return SinkSorted(input);
+	// Scatter the keys into their partitions. The key bytes remain in the arena of their run.
+	for (auto &run : state.runs) {
+		for (idx_t i = 0; i < run->keys.size(); i++) {
+			auto &partition = state.partitions[partition_map[get_partition(run->keys[i])]];
+			partition.keys.push_back(run->keys[i]);
+			partition.row_ids.push_back(run->row_ids[i]);
+		}
+		run->keys = unsafe_vector<ARTKey>();
+		run->row_ids = unsafe_vector<ARTKey>();
 	}
-	return SinkUnsorted(input);
 }
 
-SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
-                                                      OperatorSinkCombineInput &input) const {
+class CreateARTIndexBulkLoadTask : public ExecutorTask {
+public:
+	CreateARTIndexBulkLoadTask(shared_ptr<Event> event_p, ClientContext &context,
+	                           CreateARTIndexGlobalSinkState &state, const PhysicalCreateARTIndex &op_p)
+	    : ExecutorTask(context, std::move(event_p), op_p), state(state), create_index(op_p) {
+	}
 
-	auto &g_state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
-	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		// Construct the ARTs of partitions until none are left.
+		while (true) {
+			auto partition_idx = state.next_partition++;
+			if (partition_idx >= state.partitions.size()) {
+				break;
+			}
+			auto &partition = state.partitions[partition_idx];
+			partition.art = create_index.CreateART();
+			BulkLoad(*partition.art, partition.keys, partition.row_ids);
+			partition.keys = unsafe_vector<ARTKey>();
+			partition.row_ids = unsafe_vector<ARTKey>();
+		}
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
 
-	// merge the local index into the global index
-	if (!g_state.global_index->MergeIndexes(*l_state.local_index)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
+private:
+	CreateARTIndexGlobalSinkState &state;
+	const PhysicalCreateARTIndex &create_index;
+};
+
+class CreateARTIndexBulkLoadEvent : public BasePipelineEvent {
+public:
+	CreateARTIndexBulkLoadEvent(CreateARTIndexGlobalSinkState &state_p, Pipeline &pipeline_p,
+	                            const PhysicalCreateARTIndex &op_p)
+	    : BasePipelineEvent(pipeline_p), state(state_p), op(op_p) {
 	}
 
-	return SinkCombineResultType::FINISHED;
-}
+	CreateARTIndexGlobalSinkState &state;
+	const PhysicalCreateARTIndex &op;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+		auto &ts = TaskScheduler::GetScheduler(context);
+		auto num_threads = NumericCast<idx_t>(ts.NumberOfThreads());
+		auto task_count = MinValue(num_threads, state.partitions.size());
+
+		vector<shared_ptr<Task>> tasks;
+		for (idx_t i = 0; i < task_count; i++) {
+			tasks.push_back(make_uniq<CreateARTIndexBulkLoadTask>(shared_from_this(), context, state, op));
+		}
+		SetTasks(std::move(tasks));
+	}
+
+	void FinishEvent() override {
+		// The partitions are disjoint subtrees, so merging them only adds them as children of the common prefix.
+		for (auto &partition : state.partitions) {
+			if (!state.global_index->MergeIndexes(*partition.art)) {
+				throw ConstraintException("Data contains duplicates on indexed column(s)");
+			}
+			partition.art.reset();
+		}
+		state.partitions.clear();
+		state.runs.clear();
+		op.FinalizeIndex(pipeline->GetClientContext(), state);
+	}
+};
 
 SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                                   OperatorSinkFinalizeInput &input) const {
+	auto &state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
+	if (state.runs.empty()) {
+		FinalizeIndex(context, state);
+		return SinkFinalizeType::READY;
+	}
 
+	// Bulk-load the buffered keys: we construct the partitions in parallel, and then merge them into the index.
+	PartitionKeys(state);
+	auto new_event = make_shared_ptr<CreateARTIndexBulkLoadEvent>(state, pipeline, *this);
+	event.InsertEvent(std::move(new_event));
+	return SinkFinalizeType::READY;
+}
+
+void PhysicalCreateARTIndex::FinalizeIndex(ClientContext &context, GlobalSinkState &gstate) const {
 	// here, we set the resulting global index as the newly created index of the table
-	auto &state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
+	auto &state = gstate.Cast<CreateARTIndexGlobalSinkState>();
 
 	// vacuum excess memory and verify
 	state.global_index->Vacuum();
@@ -172,7 +383,7 @@ SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &eve
 			throw CatalogException("Index with name \"%s\" already exists!", info->index_name);
 		}
 		// IF NOT EXISTS on existing index. We are done.
-		return SinkFinalizeType::READY;
+		return;
 	}
 
 	auto index_entry = schema.CreateIndex(schema.GetCatalogTransaction(context), *info, table).get();
@@ -182,7 +393,6 @@ SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &eve
 
 	// add index to storage
 	storage.AddIndex(std::move(state.global_index));
-	return SinkFinalizeType::READY;
 }
 
 //===--------------------------------------------------------------------===//
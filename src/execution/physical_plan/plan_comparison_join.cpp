@@ -1,7 +1,9 @@
+#include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/operator/join/perfect_hash_join_executor.hpp"
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
@@ -12,6 +14,9 @@
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/join/physical_blockwise_nl_join.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
@@ -121,6 +126,131 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	return;
 }
 
+static unique_ptr<PhysicalOperator> TryPlanIndexJoin(ClientContext &context, LogicalComparisonJoin &op,
+                                                     unique_ptr<PhysicalOperator> &left,
+                                                     unique_ptr<PhysicalOperator> &right, bool index_on_left) {
+	auto &probe = index_on_left ? right : left;
+	auto &table_side = index_on_left ? left : right;
+	// a filter directly on top of the scan (e.g. added by the statistics propagation) is evaluated by the index join
+	auto table_scan = table_side.get();
+	if (table_scan->type == PhysicalOperatorType::FILTER) {
+		table_scan = table_scan->children[0].get();
+	}
+	if (table_scan->type != PhysicalOperatorType::TABLE_SCAN) {
+		return nullptr;
+	}
+	auto &scan = table_scan->Cast<PhysicalTableScan>();
+	if (scan.function.name != "seq_scan") {
+		return nullptr;
+	}
+	auto &bind_data = scan.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_create_index) {
+		return nullptr;
+	}
+	auto &storage = bind_data.table.GetStorage();
+
+	// we only probe the index if the probe side is small compared to the table,
+	// using the same thresholds that decide between index scans and table scans
+	auto &db_config = DBConfig::GetConfig(context);
+	auto total_rows = storage.GetTotalRows();
+	auto total_rows_from_percentage =
+	    LossyNumericCast<idx_t>(double(total_rows) * db_config.options.index_scan_percentage);
+	auto max_count = MaxValue(db_config.options.index_scan_max_count, total_rows_from_percentage);
+	if (probe->estimated_cardinality > max_count || probe->estimated_cardinality >= total_rows) {
+		return nullptr;
+	}
+
+	// all conditions must be equalities on columns of the table
+	vector<column_t> key_columns;
+	for (auto &cond : op.conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+			return nullptr;
+		}
+		auto &table_key = index_on_left ? *cond.left : *cond.right;
+		if (table_key.type != ExpressionType::BOUND_REF) {
+			return nullptr;
+		}
+		auto scan_column = table_key.Cast<BoundReferenceExpression>().index;
+		if (!scan.projection_ids.empty()) {
+			scan_column = scan.projection_ids[scan_column];
+		}
+		key_columns.push_back(scan.column_ids[scan_column]);
+	}
+
+	// look for an ART whose key columns are exactly the join columns
+	string index_name;
+	vector<idx_t> condition_order;
+	auto checkpoint_lock = storage.GetSharedCheckpointLock();
+	auto &info = storage.GetDataTableInfo();
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
+		if (art_index.unbound_expressions.size() != op.conditions.size()) {
+			return false;
+		}
+		vector<idx_t> order;
+		vector<bool> used(key_columns.size(), false);
+		for (idx_t i = 0; i < art_index.unbound_expressions.size(); i++) {
+			auto &index_expression = *art_index.unbound_expressions[i];
+			if (index_expression.type != ExpressionType::BOUND_COLUMN_REF) {
+				return false;
+			}
+			auto &colref = index_expression.Cast<BoundColumnRefExpression>();
+			auto column_id = art_index.GetColumnIds()[colref.binding.column_index];
+			idx_t cond_idx;
+			for (cond_idx = 0; cond_idx < key_columns.size(); cond_idx++) {
+				auto &probe_key = index_on_left ? *op.conditions[cond_idx].right : *op.conditions[cond_idx].left;
+				if (!used[cond_idx] && key_columns[cond_idx] == column_id &&
+				    probe_key.return_type == art_index.logical_types[i]) {
+					break;
+				}
+			}
+			if (cond_idx == key_columns.size()) {
+				return false;
+			}
+			used[cond_idx] = true;
+			order.push_back(cond_idx);
+		}
+		index_name = art_index.GetIndexName();
+		condition_order = std::move(order);
+		return true;
+	});
+	if (index_name.empty()) {
+		return nullptr;
+	}
+
+	vector<JoinCondition> conditions;
+	for (auto &cond_idx : condition_order) {
+		conditions.push_back(std::move(op.conditions[cond_idx]));
+	}
+	unique_ptr<Expression> residual_filter;
+	auto scan_op = std::move(table_side);
+	if (scan_op->type == PhysicalOperatorType::FILTER) {
+		residual_filter = std::move(scan_op->Cast<PhysicalFilter>().expression);
+		scan_op = std::move(scan_op->children[0]);
+	}
+	return make_uniq<PhysicalIndexJoin>(op, std::move(probe), std::move(scan_op), std::move(conditions),
+	                                    op.join_type, op.left_projection_map, op.right_projection_map,
+	                                    std::move(index_name), index_on_left, std::move(residual_filter),
+	                                    op.estimated_cardinality);
+}
+
+static unique_ptr<PhysicalOperator> PlanIndexJoin(ClientContext &context, LogicalComparisonJoin &op,
+                                                  unique_ptr<PhysicalOperator> &left,
+                                                  unique_ptr<PhysicalOperator> &right) {
+	// we only use index joins for inner joins
+	if (op.join_type != JoinType::INNER) {
+		return nullptr;
+	}
+	if (!ClientConfig::GetConfig(context).enable_optimizer) {
+		return nullptr;
+	}
+	// prefer probing the index of the right side, i.e., keep the left side as the probe side
+	auto plan = TryPlanIndexJoin(context, op, left, right, false);
+	if (!plan) {
+		plan = TryPlanIndexJoin(context, op, left, right, true);
+	}
+	return plan;
+}
+
 static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	if (expr.type == ExpressionType::BOUND_REF) {
 		auto &ref = expr.Cast<BoundReferenceExpression>();
@@ -191,6 +321,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 
 	unique_ptr<PhysicalOperator> plan;
 	if (has_equality && !prefer_range_joins) {
+		// Equality join with a small probe side and an index on the other side: index nested-loop join
+		plan = PlanIndexJoin(context, op, left, right);
+		if (plan) {
+			return plan;
+		}
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
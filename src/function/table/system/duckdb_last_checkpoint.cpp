@@ -0,0 +1,97 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBLastCheckpointData : public GlobalTableFunctionState {
+	DuckDBLastCheckpointData() : offset(0) {
+	}
+
+	vector<pair<string, CheckpointStatistics>> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBLastCheckpointBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("table_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("row_group_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("write_data_seconds");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("write_metadata_seconds");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("finalize_seconds");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("total_seconds");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return nullptr;
+}
+
+static unique_ptr<GlobalTableFunctionState> DuckDBLastCheckpointInit(ClientContext &context,
+                                                                     TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBLastCheckpointData>();
+
+	auto databases = DatabaseManager::Get(context).GetDatabases(context);
+	for (auto &db_ref : databases) {
+		auto &db = db_ref.get();
+		if (db.IsSystem() || db.IsTemporary() || !db.GetCatalog().IsDuckCatalog()) {
+			continue;
+		}
+		CheckpointStatistics statistics;
+		if (!db.GetStorageManager().GetLastCheckpoint(statistics)) {
+			continue;
+		}
+		result->entries.emplace_back(db.GetName(), statistics);
+	}
+	return std::move(result);
+}
+
+static void DuckDBLastCheckpointFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBLastCheckpointData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		auto &statistics = entry.second;
+		idx_t col = 0;
+		// database_name, VARCHAR
+		output.SetValue(col++, count, Value(entry.first));
+		// table_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(statistics.table_count)));
+		// row_group_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(statistics.row_group_count)));
+		// write_data_seconds, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(statistics.write_data_seconds));
+		// write_metadata_seconds, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(statistics.write_metadata_seconds));
+		// finalize_seconds, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(statistics.finalize_seconds));
+		// total_seconds, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(statistics.total_seconds));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBLastCheckpointFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_last_checkpoint", {}, DuckDBLastCheckpointFunction,
+	                              DuckDBLastCheckpointBind, DuckDBLastCheckpointInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,77 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/plan_cache.hpp"
+
+namespace duckdb {
+
+struct DuckDBPlanCacheData : public GlobalTableFunctionState {
+	DuckDBPlanCacheData() : offset(0) {
+	}
+
+	vector<PlanCacheInformation> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBPlanCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                    vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("query");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("hit_rate");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("cached_plans");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+static unique_ptr<GlobalTableFunctionState> DuckDBPlanCacheInit(ClientContext &context,
+                                                                TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBPlanCacheData>();
+
+	result->entries = PlanCache::Get(context).GetInformation();
+	return std::move(result);
+}
+
+static void DuckDBPlanCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBPlanCacheData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// query, VARCHAR
+		output.SetValue(col++, count, Value(entry.query));
+		// hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.hits)));
+		// misses, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.misses)));
+		// hit_rate, DOUBLE
+		auto total = entry.hits + entry.misses;
+		output.SetValue(col++, count,
+		                Value::DOUBLE(total == 0 ? 0 : static_cast<double>(entry.hits) / static_cast<double>(total)));
+		// cached_plans, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.cached_plans)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBPlanCacheFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_plan_cache", {}, DuckDBPlanCacheFunction, DuckDBPlanCacheBind, DuckDBPlanCacheInit));
+}
+
+} // namespace duckdb
@@ -19,6 +19,9 @@ static unique_ptr<FunctionData> DuckDBTemporaryFilesBind(ClientContext &context,
 	names.emplace_back("size");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("uncompressed_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
 	return nullptr;
 }
 
@@ -42,10 +45,12 @@ void DuckDBTemporaryFilesFunction(ClientContext &context, TableFunctionInput &da
 		auto &entry = data.entries[data.offset++];
 		// return values:
 		idx_t col = 0;
-		// database_name, VARCHAR
+		// path, VARCHAR
 		output.SetValue(col++, count, entry.path);
-		// database_oid, BIGINT
+		// size, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.size)));
+		// uncompressed_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.uncompressed_size)));
 		count++;
 	}
 	output.SetCardinality(count);
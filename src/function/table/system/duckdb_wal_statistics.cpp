@@ -0,0 +1,116 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBWALStatisticsData : public GlobalTableFunctionState {
+	DuckDBWALStatisticsData() : offset(0) {
+	}
+
+	vector<pair<string, WALStatistics>> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBWALStatisticsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                        vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("commit_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("sync_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("avg_batch_size");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("max_batch_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("syncs_per_second");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("sync_seconds");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("replayed_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("replay_seconds");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return nullptr;
+}
+
+static unique_ptr<GlobalTableFunctionState> DuckDBWALStatisticsInit(ClientContext &context,
+                                                                    TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBWALStatisticsData>();
+
+	auto databases = DatabaseManager::Get(context).GetDatabases(context);
+	for (auto &db_ref : databases) {
+		auto &db = db_ref.get();
+		if (db.IsSystem() || db.IsTemporary() || !db.GetCatalog().IsDuckCatalog()) {
+			continue;
+		}
+		auto &storage_manager = db.GetStorageManager();
+		if (storage_manager.InMemory()) {
+			continue;
+		}
+		result->entries.emplace_back(db.GetName(), storage_manager.GetWALStatistics());
+	}
+	return std::move(result);
+}
+
+static void DuckDBWALStatisticsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBWALStatisticsData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		auto &statistics = entry.second;
+		idx_t col = 0;
+		// database_name, VARCHAR
+		output.SetValue(col++, count, Value(entry.first));
+		// commit_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(statistics.commit_count)));
+		// sync_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(statistics.sync_count)));
+		// avg_batch_size, DOUBLE
+		if (statistics.sync_count == 0) {
+			output.SetValue(col++, count, Value());
+		} else {
+			auto avg_batch_size = double(statistics.synced_commit_count) / double(statistics.sync_count);
+			output.SetValue(col++, count, Value::DOUBLE(avg_batch_size));
+		}
+		// max_batch_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(statistics.max_batch_size)));
+		// syncs_per_second, DOUBLE
+		if (statistics.elapsed_seconds <= 0) {
+			output.SetValue(col++, count, Value());
+		} else {
+			output.SetValue(col++, count, Value::DOUBLE(double(statistics.sync_count) / statistics.elapsed_seconds));
+		}
+		// sync_seconds, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(statistics.sync_seconds));
+		// replayed_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(statistics.replayed_bytes)));
+		// replay_seconds, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(statistics.replay_seconds));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBWALStatisticsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_wal_statistics", {}, DuckDBWALStatisticsFunction, DuckDBWALStatisticsBind,
+	                              DuckDBWALStatisticsInit));
+}
+
+} // namespace duckdb
@@ -6,6 +6,7 @@
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/art_key.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_config.hpp"
@@ -221,6 +222,12 @@ struct IndexScanGlobalState : public GlobalTableFunctionState {
 	TableScanState local_storage_state;
 	vector<storage_t> column_ids;
 	bool finished;
+	//! For index-only scans: the output columns of each index key column, and the output columns of the row id.
+	//! A column can be part of the output more than once, e.g., for UPDATE statements.
+	//! We only decode the key columns up to the last one that is part of the output.
+	vector<vector<idx_t>> key_output_columns;
+	vector<PhysicalType> key_types;
+	vector<idx_t> row_id_output_columns;
 };
 
 static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
@@ -243,10 +250,67 @@ static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &c
 	result->local_storage_state.Initialize(result->column_ids, input.filters.get());
 	local_storage.InitializeScan(bind_data.table.GetStorage(), result->local_storage_state.local_state, input.filters);
 
+	if (bind_data.is_index_only_scan) {
+		for (idx_t i = 0; i < input.column_ids.size(); i++) {
+			auto column_id = input.column_ids[i];
+			if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+				result->row_id_output_columns.push_back(i);
+				continue;
+			}
+			for (idx_t key_idx = 0; key_idx < bind_data.key_column_ids.size(); key_idx++) {
+				if (bind_data.key_column_ids[key_idx] != column_id) {
+					continue;
+				}
+				if (result->key_output_columns.size() <= key_idx) {
+					result->key_output_columns.resize(key_idx + 1);
+				}
+				result->key_output_columns[key_idx].push_back(i);
+				break;
+			}
+		}
+		for (idx_t key_idx = 0; key_idx < result->key_output_columns.size(); key_idx++) {
+			result->key_types.push_back(bind_data.key_types[key_idx].InternalType());
+		}
+	}
+
 	result->finished = false;
 	return std::move(result);
 }
 
+//! Produces the output of an index-only scan by decoding the index keys.
+//! We do not fetch any column data, we only check the visibility of the rows.
+static void IndexOnlyFetch(DuckTransaction &transaction, const TableScanBindData &bind_data,
+                           IndexScanGlobalState &state, const Vector &row_ids, const idx_t scan_count,
+                           DataChunk &output) {
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	auto count = bind_data.table.GetStorage().SelectVisibleRows(transaction, row_ids, scan_count, sel);
+	auto row_id_data = FlatVector::GetData<row_t>(row_ids);
+
+	for (idx_t i = 0; i < count; i++) {
+		auto row_idx = sel.get_index(i);
+		for (auto &output_idx : state.row_id_output_columns) {
+			FlatVector::GetData<row_t>(output.data[output_idx])[i] = row_id_data[row_idx];
+		}
+
+		auto key_idx = state.row_ids_offset + row_idx;
+		auto key = bind_data.key_data.data() + bind_data.key_offsets[key_idx];
+		idx_t offset = 0;
+		for (idx_t col_idx = 0; col_idx < state.key_output_columns.size(); col_idx++) {
+			auto &output_indexes = state.key_output_columns[col_idx];
+			if (output_indexes.empty()) {
+				offset = ARTKey::Decode(state.key_types[col_idx], key, offset, nullptr, i);
+				continue;
+			}
+			idx_t next_offset = offset;
+			for (auto &output_idx : output_indexes) {
+				next_offset = ARTKey::Decode(state.key_types[col_idx], key, offset, output.data[output_idx], i);
+			}
+			offset = next_offset;
+		}
+	}
+	output.SetCardinality(count);
+}
+
 static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
 	auto &state = data_p.global_state->Cast<IndexScanGlobalState>();
@@ -258,8 +322,12 @@ static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p
 		auto scan_count = remaining < STANDARD_VECTOR_SIZE ? remaining : STANDARD_VECTOR_SIZE;
 
 		Vector row_ids(state.row_ids, state.row_ids_offset, state.row_ids_offset + scan_count);
-		bind_data.table.GetStorage().Fetch(transaction, output, state.column_ids, row_ids, scan_count,
-		                                   state.fetch_state);
+		if (bind_data.is_index_only_scan) {
+			IndexOnlyFetch(transaction, bind_data, state, row_ids, scan_count, output);
+		} else {
+			bind_data.table.GetStorage().Fetch(transaction, output, state.column_ids, row_ids, scan_count,
+			                                   state.fetch_state);
+		}
 
 		state.row_ids_offset += scan_count;
 		if (state.row_ids_offset == state.row_ids_count) {
@@ -293,6 +361,32 @@ static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &ex
 	    expr, [&](Expression &child) { RewriteIndexExpression(index, get, child, rewrite_possible); });
 }
 
+//! Returns true, if the scan only needs the row id and columns of the index key, and if we can decode all key
+//! columns. Then, we can produce the output of an index scan from the index keys alone.
+static bool TryGetIndexOnlyColumns(ART &art, LogicalGet &get, vector<column_t> &key_column_ids,
+                                   vector<LogicalType> &key_types) {
+	auto &index_column_ids = art.GetColumnIds();
+	for (idx_t i = 0; i < art.unbound_expressions.size(); i++) {
+		auto &expr = *art.unbound_expressions[i];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF || !ARTKey::CanDecode(art.types[i])) {
+			return false;
+		}
+		auto &bound_colref = expr.Cast<BoundColumnRefExpression>();
+		key_column_ids.push_back(index_column_ids[bound_colref.binding.column_index]);
+		key_types.push_back(art.logical_types[i]);
+	}
+
+	for (auto &column_id : get.GetColumnIds()) {
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			continue;
+		}
+		if (std::find(key_column_ids.begin(), key_column_ids.end(), column_id) == key_column_ids.end()) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
                                     vector<unique_ptr<Expression>> &filters) {
 	auto &bind_data = bind_data_p->Cast<TableScanBindData>();
@@ -326,52 +420,76 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 
 	// bind and scan any ART indexes
 	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
-		// first rewrite the index expression so the ColumnBindings align with the column bindings of the current table
-		if (art_index.unbound_expressions.size() > 1) {
-			// NOTE: index scans are not (yet) supported for compound index keys
-			return false;
+		// first rewrite the index expressions so the ColumnBindings align with the column bindings of the current table
+		// we can scan a compound index with a prefix of its expressions, so we stop at the first one we cannot rewrite
+		vector<unique_ptr<Expression>> index_expressions;
+		for (auto &unbound_expression : art_index.unbound_expressions) {
+			auto index_expression = unbound_expression->Copy();
+			bool rewrite_possible = true;
+			RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
+			if (!rewrite_possible) {
+				break;
+			}
+			index_expressions.push_back(std::move(index_expression));
 		}
-
-		auto index_expression = art_index.unbound_expressions[0]->Copy();
-		bool rewrite_possible = true;
-		RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
-		if (!rewrite_possible) {
+		if (index_expressions.empty()) {
 			// could not rewrite!
 			return false;
 		}
 
-		// Try to find a matching index for any of the filter expressions.
-		for (auto &filter : filters) {
-			auto index_state = art_index.TryInitializeScan(*index_expression, *filter);
-			if (index_state != nullptr) {
-
-				auto &db_config = DBConfig::GetConfig(context);
-				auto index_scan_percentage = db_config.options.index_scan_percentage;
-				auto index_scan_max_count = db_config.options.index_scan_max_count;
-
-				auto total_rows = storage.GetTotalRows();
-				auto total_rows_from_percentage = LossyNumericCast<idx_t>(double(total_rows) * index_scan_percentage);
-				auto max_count = MaxValue(index_scan_max_count, total_rows_from_percentage);
-
-				// Check if we can use an index scan, and already retrieve the matching row ids.
-				if (art_index.Scan(*index_state, max_count, bind_data.row_ids)) {
-					bind_data.is_index_scan = true;
-					get.function = TableScanFunction::GetIndexScanFunction();
-					return true;
-				}
+		// Try to find a matching index scan for the filter expressions.
+		auto index_state = art_index.TryInitializeScan(index_expressions, filters);
+		if (index_state == nullptr) {
+			return false;
+		}
 
-				// Clear the row ids in case we exceeded the maximum count and stopped scanning.
-				bind_data.row_ids.clear();
-				return true;
-			}
+		auto &db_config = DBConfig::GetConfig(context);
+		auto index_scan_percentage = db_config.options.index_scan_percentage;
+		auto index_scan_max_count = db_config.options.index_scan_max_count;
+
+		auto total_rows = storage.GetTotalRows();
+		auto total_rows_from_percentage = LossyNumericCast<idx_t>(double(total_rows) * index_scan_percentage);
+		auto max_count = MaxValue(index_scan_max_count, total_rows_from_percentage);
+
+		// If the scan only needs columns of the index key, then we also retrieve the key of each row id,
+		// and we do not need to fetch the rows from the table.
+		vector<column_t> key_column_ids;
+		vector<LogicalType> key_types;
+		auto index_only = TryGetIndexOnlyColumns(art_index, get, key_column_ids, key_types);
+
+		// Check if we can use an index scan, and already retrieve the matching row ids.
+		bool finished;
+		if (index_only) {
+			ARTKeyList keys;
+			finished = art_index.Scan(*index_state, max_count, bind_data.row_ids, keys);
+			bind_data.key_data = std::move(keys.data);
+			bind_data.key_offsets = std::move(keys.offsets);
+		} else {
+			finished = art_index.Scan(*index_state, max_count, bind_data.row_ids);
+		}
+		if (finished) {
+			bind_data.is_index_scan = true;
+			bind_data.is_index_only_scan = index_only;
+			bind_data.key_column_ids = std::move(key_column_ids);
+			bind_data.key_types = std::move(key_types);
+			get.function = TableScanFunction::GetIndexScanFunction();
+			return true;
 		}
-		return false;
+
+		// Clear the row ids in case we exceeded the maximum count and stopped scanning.
+		bind_data.row_ids.clear();
+		bind_data.key_data.clear();
+		bind_data.key_offsets.clear();
+		return true;
 	});
 }
 
 string TableScanToString(const FunctionData *bind_data_p) {
 	auto &bind_data = bind_data_p->Cast<TableScanBindData>();
 	string result = bind_data.table.name;
+	if (bind_data.is_index_only_scan) {
+		result += "\n(index only)";
+	}
 	return result;
 }
 
@@ -384,6 +502,11 @@ static void TableScanSerialize(Serializer &serializer, const optional_ptr<Functi
 	serializer.WriteProperty(103, "is_index_scan", bind_data.is_index_scan);
 	serializer.WriteProperty(104, "is_create_index", bind_data.is_create_index);
 	serializer.WriteProperty(105, "result_ids", bind_data.row_ids);
+	serializer.WritePropertyWithDefault(106, "is_index_only_scan", bind_data.is_index_only_scan, false);
+	serializer.WritePropertyWithDefault(107, "key_data", bind_data.key_data);
+	serializer.WritePropertyWithDefault(108, "key_offsets", bind_data.key_offsets);
+	serializer.WritePropertyWithDefault(109, "key_column_ids", bind_data.key_column_ids);
+	serializer.WritePropertyWithDefault(110, "key_types", bind_data.key_types);
 }
 
 static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer, TableFunction &function) {
@@ -399,6 +522,11 @@ static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer,
 	deserializer.ReadProperty(103, "is_index_scan", result->is_index_scan);
 	deserializer.ReadProperty(104, "is_create_index", result->is_create_index);
 	deserializer.ReadProperty(105, "result_ids", result->row_ids);
+	deserializer.ReadPropertyWithExplicitDefault(106, "is_index_only_scan", result->is_index_only_scan, false);
+	deserializer.ReadPropertyWithDefault(107, "key_data", result->key_data);
+	deserializer.ReadPropertyWithDefault(108, "key_offsets", result->key_offsets);
+	deserializer.ReadPropertyWithDefault(109, "key_column_ids", result->key_column_ids);
+	deserializer.ReadPropertyWithDefault(110, "key_types", result->key_types);
 	return std::move(result);
 }
 
@@ -31,6 +31,7 @@ enum class MetricsType : uint8_t {
     OPERATOR_ROWS_SCANNED,
     OPERATOR_TIMING,
     RESULT_SET_SIZE,
+    SCHEDULER_WAIT_TIME,
     ALL_OPTIMIZERS,
     CUMULATIVE_OPTIMIZER_TIMING,
     PLANNER,
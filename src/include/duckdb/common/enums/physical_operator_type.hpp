@@ -62,6 +62,7 @@ enum class PhysicalOperatorType : uint8_t {
 	RIGHT_DELIM_JOIN,
 	POSITIONAL_JOIN,
 	ASOF_JOIN,
+	INDEX_JOIN,
 	// -----------------------------
 	// SetOps
 	// -----------------------------
@@ -28,6 +28,9 @@ public:
 	                        const data_ptr_t &r_ptr, const SortLayout &sort_layout, const bool &external_sort);
 	//! Compare two blob values
 	static int CompareVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, const LogicalType &type);
+	//! Compare two blob values that are tied by their prefix of 'prefix_len' bytes in the sort key
+	static int CompareTiedVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, const LogicalType &type,
+	                          const idx_t &prefix_len);
 
 private:
 	//! Compares two blob values that were initially tied by their prefix
@@ -22,6 +22,11 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	static constexpr idx_t MAX_MERGE_FAN_IN = 16;
+	//! Strings that are shorter than this (according to the statistics) are fully normalized into the sort key
+	static constexpr idx_t MAX_NORMALIZED_STRING_LENGTH = 64;
+	//! The length of the prefix of other strings that is normalized into the sort key
+	static constexpr idx_t STRING_PREFIX_LENGTH = 12;
 };
 
 struct SortLayout {
@@ -61,6 +66,10 @@ public:
 	void PrepareMergePhase();
 	//! Initializes the global sort state for another round of merging
 	void InitializeMergeRound();
+	//! Whether the remaining sorted blocks can be merged in a single round
+	bool IsFinalMergeRound() const {
+		return sorted_blocks.size() <= merge_fan_in;
+	}
 	//! Completes the cascaded merge sort round.
 	//! Pass true if you wish to use the radix data for further comparisons.
 	void CompleteMergeRound(bool keep_radix_data = false);
@@ -90,12 +99,16 @@ public:
 	idx_t block_capacity;
 	//! Whether we are doing an external sort
 	bool external;
+	//! The (maximum) number of sorted blocks that are merged at once
+	idx_t merge_fan_in;
 
 	//! Progress in merge path stage
-	idx_t pair_idx;
-	idx_t num_pairs;
-	idx_t l_start;
-	idx_t r_start;
+	idx_t group_idx;
+	idx_t num_groups;
+	//! Number of partitions of the current round that have been handed out
+	idx_t partition_idx;
+	//! Merge path start indices within the sorted blocks of the current group
+	vector<idx_t> merge_starts;
 };
 
 struct LocalSortState {
@@ -147,12 +160,17 @@ private:
 	Vector addresses = Vector(LogicalType::POINTER);
 };
 
+//! The MergeSorter merges groups of (up to merge_fan_in) sorted blocks using a loser tree. The output of a group is
+//! split into partitions of block_capacity rows using Merge Path, so that multiple threads can merge the same group
 struct MergeSorter {
 public:
 	MergeSorter(GlobalSortState &state, BufferManager &buffer_manager);
 
 	//! Finds and merges partitions until the current cascaded merge round is finished
 	void PerformInMergeRound();
+	//! Merges the next partition of the current (final) merge round into a new block that holds only payload data,
+	//! or returns nullptr if the round is finished. Used to scan the sorted data without materializing it
+	unique_ptr<SortedBlock> MergeNextPayloadPartition(idx_t &partition_idx);
 
 private:
 	//! The global sorting state
@@ -161,47 +179,48 @@ private:
 	BufferManager &buffer_manager;
 	const SortLayout &sort_layout;
 
-	//! The left and right reader
-	unique_ptr<SBScanState> left;
-	unique_ptr<SBScanState> right;
-
-	//! Input and output blocks
-	unique_ptr<SortedBlock> left_input;
-	unique_ptr<SortedBlock> right_input;
+	//! The readers of the sorted blocks that are merged
+	vector<unique_ptr<SBScanState>> scans;
+	//! The input blocks and the output block
+	vector<unique_ptr<SortedBlock>> inputs;
 	SortedBlock *result;
+	//! Whether to only merge the payload data (and not the sorting data)
+	bool payload_only;
+
+	//! Loser tree of the runs: tree[0] holds the winner, the inner nodes hold the loser of their subtree
+	vector<idx_t> tree;
+	//! Pointer to the radix sorting data of the current entry of each run (nullptr if the run is exhausted)
+	vector<data_ptr_t> heads;
 
 private:
-	//! Computes the left and right block that will be merged next (Merge Path partition)
+	//! Computes the input blocks that will be merged next (Merge Path partition)
 	void GetNextPartition();
-	//! Finds the boundary of the next partition using binary search
-	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
+	//! Finds the boundary of the next partition using binary searches in the input blocks
+	void GetIntersection(const idx_t diagonal, vector<idx_t> &ends);
+	//! Number of entries of a run after the merge start that come before the pivot entry in the merged order
+	idx_t GetRank(const idx_t run_idx, const idx_t pivot_run_idx, const idx_t pivot_idx, const idx_t end);
 	//! Compare values within SortedBlocks using a global index
 	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
 
 	//! Finds the next partition and merges it
 	void MergePartition();
 
-	//! Computes how the next 'count' tuples should be merged by setting the 'left_smaller' array
-	void ComputeMerge(const idx_t &count, bool left_smaller[]);
-
-	//! Merges the radix sorting blocks according to the 'left_smaller' array
-	void MergeRadix(const idx_t &count, const bool left_smaller[]);
-	//! Merges SortedData according to the 'left_smaller' array
-	void MergeData(SortedData &result_data, SortedData &l_data, SortedData &r_data, const idx_t &count,
-	               const bool left_smaller[], idx_t next_entry_sizes[], bool reset_indices);
-	//! Merges constant size rows according to the 'left_smaller' array
-	void MergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &l_count, data_ptr_t &r_ptr, idx_t &r_entry_idx,
-	               const idx_t &r_count, RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size,
-	               const bool left_smaller[], idx_t &copied, const idx_t &count);
-	//! Flushes constant size rows into the result
-	void FlushRows(data_ptr_t &source_ptr, idx_t &source_entry_idx, const idx_t &source_count,
-	               RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size, idx_t &copied,
-	               const idx_t &count);
-	//! Flushes blob rows and accompanying heap
-	void FlushBlobs(const RowLayout &layout, const idx_t &source_count, data_ptr_t &source_data_ptr,
-	                idx_t &source_entry_idx, data_ptr_t &source_heap_ptr, RowDataBlock &target_data_block,
-	                data_ptr_t &target_data_ptr, RowDataBlock &target_heap_block, BufferHandle &target_heap_handle,
-	                data_ptr_t &target_heap_ptr, idx_t &copied, const idx_t &count);
+	//! Whether the current entry of run l comes before the current entry of run r
+	bool RunIsSmaller(const idx_t l, const idx_t r);
+	//! Builds the loser tree for the subtree rooted at the given node, returns its winner
+	idx_t BuildTree(const idx_t node);
+	//! Advances a run to the next entry while computing the merge
+	void AdvanceRun(const idx_t run_idx);
+	//! Computes how the next 'count' tuples should be merged by setting the 'run_indices' array
+	void ComputeMerge(const idx_t &count, idx_t run_indices[]);
+
+	//! Merges the radix sorting blocks according to the 'run_indices' array
+	void MergeRadix(const idx_t &count, const idx_t run_indices[]);
+	//! Merges SortedData according to the 'run_indices' array
+	void MergeData(SortedData &result_data, const idx_t &count, const idx_t run_indices[], bool reset_indices);
+	//! Save and restore the indices of all readers
+	void SaveIndices(vector<pair<idx_t, idx_t>> &indices) const;
+	void RestoreIndices(const vector<pair<idx_t, idx_t>> &indices);
 };
 
 struct SBIterator {
@@ -25,6 +25,7 @@ enum class VerifyExistenceType : uint8_t {
 class ConflictManager;
 class ARTKey;
 class ARTKeySection;
+struct ARTKeyList;
 class FixedSizeAllocator;
 
 struct ARTIndexScanState;
@@ -65,11 +66,20 @@ public:
 	uint8_t prefix_count;
 
 public:
-	//! Try to initialize a scan on the ART with the given expression and filter.
-	unique_ptr<IndexScanState> TryInitializeScan(const Expression &expr, const Expression &filter_expr);
-	//! Perform a lookup on the ART, fetching up to max_count row IDs.
+	//! Try to initialize a scan on the ART with the given (bound) index expressions and filters.
+	//! The index expressions can be a prefix of the expressions of a compound index.
+	//! Supports range scans, prefix scans over compound keys, and point lookups for IN lists and OR-equalities.
+	unique_ptr<IndexScanState> TryInitializeScan(const vector<unique_ptr<Expression>> &index_expressions,
+	                                             const vector<unique_ptr<Expression>> &filters);
+	//! Perform a lookup on the ART, fetching up to max_count row IDs in ascending order.
 	//! If all row IDs were fetched, it return true, else false.
 	bool Scan(IndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids);
+	//! Perform an index-only lookup on the ART: like Scan, but we also return the key of each row ID in keys.
+	bool Scan(IndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids, ARTKeyList &keys);
+	//! Perform an equality lookup for each of the first count keys, e.g., to probe the ART in an index join.
+	//! The row IDs of keys[i] are in row_ids[offsets[i]] until row_ids[offsets[i + 1]]. Empty (NULL) keys never match.
+	void SearchEqualJoin(unsafe_vector<ARTKey> &keys, idx_t count, unsafe_vector<row_t> &row_ids,
+	                     unsafe_vector<idx_t> &offsets);
 
 	//! Append a chunk by first executing the ART's expressions.
 	ErrorData Append(IndexLock &lock, DataChunk &input, Vector &row_ids) override;
@@ -112,11 +122,25 @@ public:
 	void VerifyAllocations(IndexLock &state) override;
 
 private:
-	bool SearchEqual(ARTKey &key, idx_t max_count, unsafe_vector<row_t> &row_ids);
-	bool SearchGreater(ARTKey &key, bool equal, idx_t max_count, unsafe_vector<row_t> &row_ids);
-	bool SearchLess(ARTKey &upper_bound, bool equal, idx_t max_count, unsafe_vector<row_t> &row_ids);
+	//! The search functions append the key of each row ID to keys, if keys is set.
+	bool SearchEqual(ARTKey &key, idx_t max_count, unsafe_vector<row_t> &row_ids,
+	                 optional_ptr<ARTKeyList> keys = nullptr);
+	bool SearchGreater(ARTKey &key, bool equal, idx_t max_count, unsafe_vector<row_t> &row_ids,
+	                   optional_ptr<ARTKeyList> keys);
+	bool SearchLess(ARTKey &upper_bound, bool equal, idx_t max_count, unsafe_vector<row_t> &row_ids,
+	                optional_ptr<ARTKeyList> keys);
 	bool SearchCloseRange(ARTKey &lower_bound, ARTKey &upper_bound, bool left_equal, bool right_equal, idx_t max_count,
-	                      unsafe_vector<row_t> &row_ids);
+	                      unsafe_vector<row_t> &row_ids, optional_ptr<ARTKeyList> keys);
+	//! Scans all keys in [lower_bound, upper_bound). The bounds can be prefixes of the keys,
+	//! and an empty upper bound scans until the end of the ART.
+	bool SearchPrefixRange(const ARTKey &lower_bound, const ARTKey &upper_bound, idx_t max_count,
+	                       unsafe_vector<row_t> &row_ids, optional_ptr<ARTKeyList> keys);
+	bool ScanInternal(IndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids,
+	                  optional_ptr<ARTKeyList> keys);
+	bool ScanPredicates(ARTIndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids,
+	                    optional_ptr<ARTKeyList> keys);
+	bool ScanPrefixes(ARTIndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids,
+	                  optional_ptr<ARTKeyList> keys);
 	const unsafe_optional_ptr<const Node> Lookup(const Node &node, const ARTKey &key, idx_t depth);
 
 	void InsertIntoEmpty(Node &node, const ARTKey &key, const idx_t depth, const ARTKey &row_id,
@@ -141,6 +165,9 @@ private:
 	void FinalizeVacuum(const unordered_set<uint8_t> &indexes);
 
 	void InitAllocators(const IndexStorageInfo &info);
+	//! Starts a new access epoch, and unloads cold buffers that are also on disk, if the buffer manager is under
+	//! memory pressure. Must be called while holding the index lock, and before accessing any nodes.
+	void EvictColdBuffers();
 	void TransformToDeprecated();
 	void Deserialize(const BlockPointer &pointer);
 	void WritePartialBlocks(const bool v1_0_0_storage);
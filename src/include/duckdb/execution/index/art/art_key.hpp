@@ -10,9 +10,11 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/radix.hpp"
 #include "duckdb/common/types/string_type.hpp"
 #include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
@@ -52,6 +54,13 @@ public:
 
 	static ARTKey CreateKey(ArenaAllocator &allocator, PhysicalType type, Value &value);
 
+	//! Returns true, if we can decode the key bytes of this type back into their values.
+	static bool CanDecode(PhysicalType type);
+	//! Decodes the value starting at data[offset] and writes it to result[result_idx]. If result is not set,
+	//! then we only skip the value. Returns the offset of the next value in a compound key.
+	static idx_t Decode(PhysicalType type, const_data_ptr_t data, idx_t offset, optional_ptr<Vector> result,
+	                    idx_t result_idx);
+
 public:
 	data_t &operator[](idx_t i) {
 		return data[i];
@@ -90,6 +99,26 @@ ARTKey ARTKey::CreateARTKey(ArenaAllocator &allocator, const char *value);
 template <>
 void ARTKey::CreateARTKey(ArenaAllocator &allocator, ARTKey &key, string_t value);
 
+//! ARTKeyList stores a list of keys in a single buffer.
+struct ARTKeyList {
+	//! The bytes of all keys.
+	unsafe_vector<data_t> data;
+	//! The i-th key is data[offsets[i], offsets[i + 1]).
+	unsafe_vector<idx_t> offsets;
+
+public:
+	//! Appends the key to the list count times.
+	void Append(const_data_ptr_t key_data, idx_t len, idx_t count = 1);
+	//! Returns the number of keys in the list.
+	idx_t Count() const {
+		return offsets.empty() ? 0 : offsets.size() - 1;
+	}
+	void Clear() {
+		data.clear();
+		offsets.clear();
+	}
+};
+
 class ARTKeySection {
 public:
 	ARTKeySection(idx_t start, idx_t end, idx_t depth, data_t byte);
@@ -43,6 +43,10 @@ public:
 	inline idx_t Size() const {
 		return key_bytes.size();
 	}
+	//! Returns a pointer to the key bytes.
+	inline const uint8_t *Data() const {
+		return key_bytes.data();
+	}
 
 	//! Returns true, if key_bytes contains all bytes of key.
 	bool Contains(const ARTKey &key) const;
@@ -65,11 +69,13 @@ public:
 public:
 	//! Scans the tree, starting at the current top node on the stack, and ending at upper_bound.
 	//! If upper_bound is the empty ARTKey, than there is no upper bound.
-	bool Scan(const ARTKey &upper_bound, const idx_t max_count, unsafe_vector<row_t> &row_ids, const bool equal);
+	//! If keys is set, then we also append the key of each row ID to it.
+	bool Scan(const ARTKey &upper_bound, const idx_t max_count, unsafe_vector<row_t> &row_ids, const bool equal,
+	          optional_ptr<ARTKeyList> keys = nullptr);
 	//! Finds the minimum (leaf) of the current subtree.
 	void FindMinimum(const Node &node);
 	//! Finds the lower bound of the ART and adds the nodes to the stack. Returns false, if the lower
-	//! bound exceeds the maximum value of the ART.
+	//! bound exceeds the maximum value of the ART. The key can be a prefix of the keys in the ART.
 	bool LowerBound(const Node &node, const ARTKey &key, const bool equal, idx_t depth);
 
 	//! Returns the nested depth.
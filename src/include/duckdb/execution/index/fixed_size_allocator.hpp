@@ -27,6 +27,8 @@ class FixedSizeAllocator {
 public:
 	//! We can vacuum 10% or more of the total in-memory footprint
 	static constexpr uint8_t VACUUM_THRESHOLD = 10;
+	//! We evict cold buffers, if the buffer manager uses 80% or more of its memory limit
+	static constexpr uint8_t EVICTION_THRESHOLD = 80;
 
 public:
 	//! Construct a new fixed-size allocator
@@ -55,6 +57,7 @@ public:
 		D_ASSERT(buffers.find(ptr.GetBufferId()) != buffers.end());
 
 		auto &buffer = buffers.find(ptr.GetBufferId())->second;
+		buffer.last_access = access_epoch;
 		auto buffer_ptr = buffer.Get(dirty);
 		return buffer_ptr + ptr.GetOffset() * segment_size + bitmask_offset;
 	}
@@ -74,6 +77,7 @@ public:
 		if (!buffer.InMemory()) {
 			return nullptr;
 		}
+		buffer.last_access = access_epoch;
 
 		auto buffer_ptr = buffer.Get();
 		auto raw_ptr = buffer_ptr + ptr.GetOffset() * segment_size + bitmask_offset;
@@ -85,6 +89,15 @@ public:
 
 	//! Returns the in-memory size in bytes
 	idx_t GetInMemorySize() const;
+	//! Returns true, if the buffer manager exceeds the eviction threshold of its memory limit
+	bool UnderMemoryPressure() const;
+	//! Starts a new access epoch. Each buffer remembers the epoch of its last access
+	inline void NextAccessEpoch() {
+		access_epoch++;
+	}
+	//! Unloads the least recently accessed half of all clean on-disk buffers, and returns the number of unloaded
+	//! buffers. No pointers to segments of this allocator must be in use
+	idx_t EvictColdBuffers();
 	//! Returns the segment size.
 	inline idx_t GetSegmentSize() const {
 		return segment_size;
@@ -146,6 +159,8 @@ private:
 	//! Total number of allocated segments in all buffers
 	//! We can recalculate this by iterating over all buffers
 	idx_t total_segment_count;
+	//! The current access epoch
+	idx_t access_epoch;
 
 	//! Buffers containing the segments
 	unordered_map<idx_t, FixedSizeBuffer> buffers;
@@ -32,7 +32,8 @@ public:
 
 //! A fixed-size buffer holds fixed-size segments of data. It lazily deserializes a buffer, if on-disk and not
 //! yet in memory, and it only serializes dirty and non-written buffers to disk during
-//! serialization.
+//! serialization. Clean on-disk buffers can be unloaded again, e.g., if they are cold and the buffer manager
+//! is under memory pressure.
 class FixedSizeBuffer {
 public:
 	//! Constants for fast offset calculations in the bitmask
@@ -58,6 +59,8 @@ public:
 	bool dirty;
 	//! True: can be vacuumed after the vacuum operation
 	bool vacuum;
+	//! The access epoch of the allocator when this buffer was last accessed
+	idx_t last_access;
 
 	//! Partial block id and offset
 	BlockPointer block_pointer;
@@ -88,6 +91,12 @@ public:
 	               const idx_t bitmask_offset);
 	//! Pin a buffer (if not in-memory)
 	void Pin();
+	//! Returns true, if the in-memory buffer is consistent with its on-disk block, i.e., if we can unload it
+	inline bool CanUnload() const {
+		return InMemory() && OnDisk() && !dirty && !vacuum;
+	}
+	//! Unloads the in-memory buffer. The next Get() pins the buffer from its on-disk block again
+	void Unload();
 	//! Returns the first free offset in a bitmask
 	uint32_t GetOffset(const idx_t bitmask_count);
 	//! Sets the allocation size, if dirty
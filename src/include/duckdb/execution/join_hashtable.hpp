@@ -341,6 +341,9 @@ public:
 		void Append(DataChunk &chunk, ProbeSpillLocalAppendState &local_state);
 		//! Finalize by merging the thread-local accumulated data
 		void Finalize();
+		//! Repartition after the radix bits of the HashTable were increased by added_bits, only the marked
+		//! partitions are split, the other partitions are moved to the first of their new partitions
+		void Repartition(idx_t added_bits, const vector<bool> &split_partitions);
 
 	public:
 		//! Prepare the next probe round
@@ -371,13 +374,10 @@ public:
 		return radix_bits;
 	}
 
-	idx_t GetPartitionStart() const {
-		return partition_start;
-	}
-
-	idx_t GetPartitionEnd() const {
-		return partition_end;
-	}
+	//! Number of partitions that were built and probed in previous rounds
+	idx_t GetCompletedPartitionCount() const;
+	//! Number of partitions that are built in the current round
+	idx_t GetCurrentPartitionCount() const;
 
 	//! Capacity of the pointer table given the ht count
 	//! (minimum of 1024 to prevent collision chance for small HT's)
@@ -404,20 +404,33 @@ public:
 
 	//! Delete blocks that belong to the current partitioned HT
 	void Reset();
-	//! Build HT for the next partitioned probe round
-	bool PrepareExternalFinalize(const idx_t max_ht_size);
+	//! Build HT for the next partitioned probe round. Packs as many of the remaining partitions as fit in max_ht_size.
+	//! If the probe spill is given, partitions that do not fit by themselves are split first
+	bool PrepareExternalFinalize(const idx_t max_ht_size, optional_ptr<ProbeSpill> probe_spill = nullptr);
 	//! Probe whatever we can, sink the rest into a thread-local HT
 	void ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys, TupleDataChunkState &key_state,
 	                   ProbeState &probe_state, DataChunk &payload, ProbeSpill &probe_spill,
 	                   ProbeSpillLocalAppendState &spill_state, DataChunk &spill_chunk);
 
+private:
+	//! Whether the partition is built in the current round
+	bool IsCurrentPartition(idx_t partition_idx) const {
+		return partition_idx < current_partitions.size() && current_partitions[partition_idx];
+	}
+	//! Increases the radix bits of the remaining partitions and splits the ones that do not fit in max_ht_size.
+	//! Returns true if this reduced the size of the largest remaining partition
+	bool SplitPartitions(const idx_t max_ht_size, ProbeSpill &probe_spill);
+	//! Get the size of the largest partition that has yet to be built (including the pointer table)
+	idx_t GetMaxRemainingPartitionSize() const;
+
 private:
 	//! The current number of radix bits used to partition
 	idx_t radix_bits;
 
-	//! First and last partition of the current probe round
-	idx_t partition_start;
-	idx_t partition_end;
+	//! Partitions that were built in previous probe rounds
+	vector<bool> completed_partitions;
+	//! Partitions that are built in the current probe round
+	vector<bool> current_partitions;
 };
 
 } // namespace duckdb
@@ -15,6 +15,7 @@
 namespace duckdb {
 class DataChunk;
 class DynamicTableFilterSet;
+class JoinHashTable;
 struct GlobalUngroupedAggregateState;
 struct LocalUngroupedAggregateState;
 
@@ -40,6 +41,11 @@ struct JoinFilterLocalState {
 };
 
 struct JoinFilterPushdownInfo {
+	//! The maximum amount of build side keys for which we create IN filters
+	static constexpr const idx_t MAX_IN_FILTER_KEYS = 128;
+	//! The maximum amount of build side keys for which we create Bloom filters
+	static constexpr const idx_t MAX_BLOOM_FILTER_KEYS = 1ULL << 24ULL;
+
 	//! The dynamic table filter set where to push filters into
 	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 	//! The filters that we should generate
@@ -53,7 +59,11 @@ public:
 
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
-	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+	void PushFilters(JoinHashTable &ht, JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+
+private:
+	//! Push IN or Bloom filters over the build side keys of the given filters into the probe side
+	void PushKeyFilters(JoinHashTable &ht, const vector<idx_t> &filter_indexes, const PhysicalOperator &op) const;
 };
 
 } // namespace duckdb
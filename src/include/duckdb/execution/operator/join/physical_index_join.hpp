@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_index_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/physical_comparison_join.hpp"
+
+namespace duckdb {
+class DuckTableEntry;
+
+//! PhysicalIndexJoin represents an index nested-loop join: the keys of each probe chunk are looked up in an ART of
+//! the other table, and the matching rows are fetched from the table. The first child is the probe side, the second
+//! child is the table scan of the indexed table. The table scan is never executed, its filters (and a filter that was
+//! on top of it) are evaluated on the fetched rows.
+class PhysicalIndexJoin : public PhysicalComparisonJoin {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::INDEX_JOIN;
+
+public:
+	PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> probe, unique_ptr<PhysicalOperator> table_scan,
+	                  vector<JoinCondition> cond, JoinType join_type, const vector<idx_t> &left_projection_map,
+	                  const vector<idx_t> &right_projection_map, string index_name, bool index_on_left,
+	                  unique_ptr<Expression> residual_filter, idx_t estimated_cardinality);
+
+	//! The name of the probed ART
+	string index_name;
+	//! True, if the indexed table is the left side of the join, i.e., if its columns come first in the output
+	bool index_on_left;
+	//! The columns of the probe side that are part of the output
+	vector<idx_t> probe_projection_map;
+	//! The storage columns fetched from the table: the output columns, the columns of the table filters and the row ID
+	vector<column_t> fetch_ids;
+	vector<LogicalType> fetch_types;
+	//! The fetched columns that are part of the output
+	vector<idx_t> table_output_map;
+	//! The filter on top of the table scan and the table filters of the scan, evaluated on the fetched rows (if any)
+	unique_ptr<Expression> table_filter;
+	//! The storage columns of the index keys (to look up transaction-local rows)
+	vector<storage_t> key_ids;
+	vector<LogicalType> key_types;
+
+public:
+	DuckTableEntry &GetTable() const;
+
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+
+public:
+	// Operator Interface
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+	unique_ptr<GlobalOperatorState> GetGlobalOperatorState(ClientContext &context) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+protected:
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+
+public:
+	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
+};
+
+} // namespace duckdb
@@ -73,6 +73,9 @@ public:
 	}
 
 	double GetProgress(ClientContext &context, GlobalSourceState &gstate) const override;
+
+private:
+	string FiltersToString(const TableFilterSet &filters) const;
 };
 
 } // namespace duckdb
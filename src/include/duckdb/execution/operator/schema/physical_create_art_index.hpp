@@ -27,7 +27,7 @@ public:
 public:
 	PhysicalCreateARTIndex(LogicalOperator &op, TableCatalogEntry &table, const vector<column_t> &column_ids,
 	                       unique_ptr<CreateIndexInfo> info, vector<unique_ptr<Expression>> unbound_expressions,
-	                       idx_t estimated_cardinality, const bool sorted);
+	                       idx_t estimated_cardinality);
 
 	//! The table to create the index for
 	DuckTableEntry &table;
@@ -37,8 +37,6 @@ public:
 	unique_ptr<CreateIndexInfo> info;
 	//! Unbound expressions to be used in the optimizer
 	vector<unique_ptr<Expression>> unbound_expressions;
-	//! Whether the pipeline sorts the data prior to index creation
-	const bool sorted;
 
 public:
 	//! Source interface, NOP for this operator
@@ -54,15 +52,15 @@ public:
 	//! Sink interface, global sink state
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
 
-	//! Sink for unsorted data: insert iteratively
-	SinkResultType SinkUnsorted(OperatorSinkInput &input) const;
-	//! Sink for sorted data: build + merge
-	SinkResultType SinkSorted(OperatorSinkInput &input) const;
+	//! Creates a new, empty ART for the index. The ART can share the node allocators of another ART.
+	unique_ptr<ART> CreateART(optional_ptr<ART> shared_allocators = nullptr) const;
 
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
 	                          OperatorSinkFinalizeInput &input) const override;
+	//! Adds the ART to the table, and creates the catalog entry of the index
+	void FinalizeIndex(ClientContext &context, GlobalSinkState &gstate) const;
 
 	bool IsSink() const override {
 		return true;
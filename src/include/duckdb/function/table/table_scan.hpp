@@ -17,7 +17,8 @@ class DuckTableEntry;
 class TableCatalogEntry;
 
 struct TableScanBindData : public TableFunctionData {
-	explicit TableScanBindData(DuckTableEntry &table) : table(table), is_index_scan(false), is_create_index(false) {
+	explicit TableScanBindData(DuckTableEntry &table)
+	    : table(table), is_index_scan(false), is_create_index(false), is_index_only_scan(false) {
 	}
 
 	//! The table to scan
@@ -29,11 +30,20 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_create_index;
 	//! The row ids to fetch in case of an index scan.
 	unsafe_vector<row_t> row_ids;
+	//! Whether or not the index scan is index-only, i.e., produces its columns from the index keys.
+	bool is_index_only_scan;
+	//! The index key of each row id in case of an index-only scan.
+	//! The key of row_ids[i] is key_data[key_offsets[i]] until key_data[key_offsets[i + 1]].
+	unsafe_vector<data_t> key_data;
+	unsafe_vector<idx_t> key_offsets;
+	//! The column ids and types of the columns of the index key.
+	vector<column_t> key_column_ids;
+	vector<LogicalType> key_types;
 
 public:
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<TableScanBindData>();
-		return &other.table == &table && row_ids == other.row_ids;
+		return &other.table == &table && row_ids == other.row_ids && is_index_only_scan == other.is_index_only_scan;
 	}
 };
 
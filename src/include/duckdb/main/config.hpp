@@ -61,6 +61,14 @@ enum class CheckpointAbort : uint8_t {
 	DEBUG_ABORT_AFTER_FREE_LIST_WRITE = 3
 };
 
+//! How commits make their write-ahead log entries durable
+enum class WALSyncMode : uint8_t {
+	//! Every commit waits until its entries are synced to disk - concurrent commits share a single sync
+	SYNC = 0,
+	//! Commits return once their entries are handed to the OS - a background thread syncs them within the interval
+	ASYNC = 1
+};
+
 typedef void (*set_global_function_t)(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 typedef void (*set_local_function_t)(ClientContext &context, const Value &parameter);
 typedef void (*reset_global_function_t)(DatabaseInstance *db, DBConfig &config);
@@ -124,6 +132,12 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether automatic checkpoints are performed by a background thread instead of the committing connection
+	bool background_checkpoint = false;
+	//! How commits make their WAL entries durable
+	WALSyncMode wal_sync_mode = WALSyncMode::SYNC;
+	//! The maximum time (in milliseconds) between an asynchronous commit and the sync of its WAL entries
+	idx_t wal_async_flush_interval = 100;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -157,6 +171,12 @@ struct DBConfigOptions {
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not to compress blocks that are written to the temporary directory
+	bool temp_file_compression = false;
+	//! The maximum number of queries whose prepared plans are cached and shared between connections (0 = disabled)
+	idx_t plan_cache_size = 0;
+	//! The maximum amount of memory used to cache query results (in bytes, 0 = disabled)
+	idx_t result_cache_memory_limit = 0;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
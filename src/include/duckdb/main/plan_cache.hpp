@@ -0,0 +1,82 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/plan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class DatabaseInstance;
+class PhysicalOperator;
+class PreparedStatementData;
+class SQLStatement;
+
+struct PlanCacheInformation {
+	//! The (normalized) query of the cached plans
+	string query;
+	//! The amount of times a cached plan was reused
+	idx_t hits;
+	//! The amount of times the query had to be planned from scratch
+	idx_t misses;
+	//! The amount of plans that are currently available for reuse
+	idx_t cached_plans;
+};
+
+//! The PlanCache is a database-wide cache of prepared plans. Prepared statements that are destroyed return their plan
+//! to the cache, after which another connection that prepares the same query can take the plan instead of parsing,
+//! binding, optimizing and physically planning the query again. A plan is only used by one prepared statement at a
+//! time, and is discarded when the catalog has changed since the plan was created.
+class PlanCache {
+public:
+	explicit PlanCache(DatabaseInstance &db);
+
+	//! The maximum amount of idle plans per query
+	static constexpr const idx_t MAX_PLANS_PER_QUERY = 8;
+
+public:
+	//! Returns the cache key of the statement, or an empty string if the statement cannot be cached
+	string GetCacheKey(ClientContext &context, SQLStatement &statement);
+	//! Takes a valid plan for the given cache key out of the cache (if any). Requires an active transaction.
+	shared_ptr<PreparedStatementData> GetPlan(ClientContext &context, const string &key);
+	//! Returns a plan that was created (or taken) for the given cache key to the cache
+	void ReturnPlan(shared_ptr<PreparedStatementData> plan);
+	//! Removes all cached plans
+	void Clear();
+	//! Returns information about the cached queries
+	vector<PlanCacheInformation> GetInformation();
+
+	DUCKDB_API static PlanCache &Get(ClientContext &context);
+	//! Returns a key that identifies the statement and the connection settings that influence its plan
+	static string GetStatementKey(ClientContext &context, SQLStatement &statement);
+
+private:
+	struct PlanCacheEntry {
+		string query;
+		vector<shared_ptr<PreparedStatementData>> plans;
+		idx_t hits = 0;
+		idx_t misses = 0;
+		idx_t last_used = 0;
+	};
+
+	//! Whether or not a physical plan only contains operators that can be shared between connections
+	static bool PlanIsShareable(const PhysicalOperator &op);
+	//! Evicts the least recently used entry, if the cache is full
+	void EvictEntries(idx_t max_entries);
+
+private:
+	DatabaseInstance &db;
+	mutex lock;
+	unordered_map<string, PlanCacheEntry> entries;
+	//! Counter used to determine the least recently used entry
+	idx_t current_use = 0;
+};
+
+} // namespace duckdb
@@ -45,11 +45,19 @@ public:
 	bound_parameter_map_t value_map;
 	//! Whether we are creating a streaming result or not
 	bool is_streaming = false;
+	//! The key under which the plan is returned to the plan cache (if any)
+	string plan_cache_key;
+	//! Whether or not the result only depends on the data of the scanned tables (only computed with the result cache)
+	bool deterministic_result = false;
+	//! The key under which the result is stored in the result cache (if any)
+	string result_cache_key;
 
 public:
 	void CheckParameterCount(idx_t parameter_count);
 	//! Whether or not the prepared statement data requires the query to rebound for the given parameters
 	bool RequireRebind(ClientContext &context, optional_ptr<case_insensitive_map_t<BoundParameterData>> values);
+	//! Whether or not all catalogs that the prepared statement relies on are unchanged since it was planned
+	bool CatalogsAreCurrent(ClientContext &context);
 	//! Bind a set of values to the prepared statement data
 	DUCKDB_API void Bind(case_insensitive_map_t<BoundParameterData> values);
 	//! Get the expected SQL Type of the bound parameter
@@ -96,9 +96,11 @@ private:
 };
 
 struct QueryInfo {
-	QueryInfo() : blocked_thread_time(0) {};
+	QueryInfo() : blocked_thread_time(0), scheduler_wait_time(0) {};
 	string query_name;
 	double blocked_thread_time;
+	//! The time the tasks of the query spent waiting in the task queue (in seconds)
+	double scheduler_wait_time;
 };
 
 //! The QueryProfiler can be used to measure timings of queries
@@ -133,7 +135,7 @@ public:
 	//! Adds the timings gathered by an OperatorProfiler to this query profiler
 	DUCKDB_API void Flush(OperatorProfiler &profiler);
 	//! Adds the top level query information to the global profiler.
-	DUCKDB_API void SetInfo(const double &blocked_thread_time);
+	DUCKDB_API void SetInfo(const double &blocked_thread_time, const double &scheduler_wait_time);
 
 	DUCKDB_API void StartPhase(MetricsType phase_metric);
 	DUCKDB_API void EndPhase();
@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/statement_type.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class BlockHandle;
+class ClientContext;
+class ColumnDataCollection;
+class DatabaseInstance;
+class LogicalOperator;
+class PhysicalOperator;
+class PreparedStatementData;
+class SQLStatement;
+struct DataTableInfo;
+
+//! The ResultCache caches the results of read-only queries. A result is keyed on the (normalized) query and the
+//! connection settings, and is only valid while the catalog is unchanged and no changes were committed to any of the
+//! tables that the query reads. Results are stored in buffers that are tagged with MemoryTag::RESULT_CACHE, and that
+//! are destroyed (instead of written to disk) when the buffer pool evicts them under memory pressure.
+class ResultCache {
+public:
+	ResultCache(DatabaseInstance &db, idx_t memory_limit);
+
+public:
+	//! Whether or not the result cache is enabled
+	bool IsEnabled() const {
+		return memory_limit > 0;
+	}
+	//! Sets the maximum amount of memory used by cached results
+	void SetMemoryLimit(idx_t limit);
+	//! Returns the cache key of the statement, or an empty string if its result cannot be cached
+	string GetCacheKey(ClientContext &context, SQLStatement &statement);
+	//! Returns a prepared statement that scans a valid cached result for the given key (if any)
+	shared_ptr<PreparedStatementData> GetResult(ClientContext &context, const string &key);
+	//! Stores the result of a prepared statement in the cache
+	void StoreResult(ClientContext &context, PreparedStatementData &prepared, ColumnDataCollection &collection);
+
+	//! Whether or not the result of a (bound, unoptimized) logical plan only depends on the data of the tables it scans
+	static bool PlanIsCacheable(LogicalOperator &op);
+
+	DUCKDB_API static ResultCache &Get(ClientContext &context);
+
+private:
+	struct ResultCacheTable {
+		shared_ptr<DataTableInfo> info;
+		//! The commit id of the last changes to the table that the result reflects
+		transaction_t commit_id;
+	};
+	struct ResultCacheEntry {
+		StatementProperties properties;
+		vector<string> names;
+		vector<LogicalType> types;
+		vector<ResultCacheTable> tables;
+		//! The buffer holding the serialized result
+		shared_ptr<BlockHandle> block;
+		idx_t size = 0;
+		idx_t row_count = 0;
+		idx_t last_used = 0;
+	};
+
+	//! Whether or not the tables read by the result are unchanged for the transaction of the context
+	bool TablesAreCurrent(ClientContext &context, ResultCacheEntry &entry, bool &stale);
+	//! Collects the tables scanned by a physical plan, returns false if the plan reads from other sources
+	static bool GetScannedTables(const PhysicalOperator &op, vector<shared_ptr<DataTableInfo>> &result);
+	//! Evicts the least recently used entries until the required memory is available
+	void EvictEntries(idx_t required_memory);
+	void RemoveEntry(unordered_map<string, ResultCacheEntry>::iterator entry);
+
+private:
+	DatabaseInstance &db;
+	mutex lock;
+	atomic<idx_t> memory_limit;
+	//! The total size of the cached results
+	idx_t memory_usage = 0;
+	unordered_map<string, ResultCacheEntry> entries;
+	//! Counter used to determine the least recently used entry
+	idx_t current_use = 0;
+};
+
+} // namespace duckdb
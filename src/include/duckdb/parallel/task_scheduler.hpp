@@ -11,6 +11,7 @@
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/reference_map.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
 
@@ -18,23 +19,58 @@ namespace duckdb {
 
 struct ConcurrentQueue;
 struct QueueProducerToken;
+struct ScheduledTask;
 class ClientContext;
 class DatabaseInstance;
 class TaskScheduler;
 
 struct SchedulerThread;
 
+//! Scheduling counters of a background worker thread
+struct SchedulerThreadInformation {
+	//! The index of the worker thread
+	idx_t thread_id;
+	//! The NUMA node the worker thread is assigned to
+	idx_t numa_node;
+	//! Whether or not the worker thread is pinned to the CPUs of its NUMA node
+	bool pinned;
+	//! The number of tasks executed by the worker thread
+	idx_t tasks_executed;
+	//! The number of tasks the worker thread took from the queue of another NUMA node
+	idx_t tasks_stolen;
+	//! The number of times the worker thread woke up without finding a task
+	idx_t idle_wakeups;
+};
+
 struct ProducerToken {
+	//! The default priority of a producer
+	static constexpr const idx_t DEFAULT_PRIORITY = 100;
+
 	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
 	~ProducerToken();
 
+	//! Sets the priority of the producer - producers that compete for threads receive CPU time proportional to it
+	void SetPriority(idx_t priority);
+	//! Returns the total time the tasks of this producer spent waiting in the task queue (in microseconds)
+	idx_t GetSchedulerWaitTime() const;
+
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
 	mutex producer_lock;
+	//! The scheduling weight of the producer
+	atomic<idx_t> priority;
+	//! The CPU time the tasks of this producer received divided by its priority (in nanoseconds)
+	atomic<idx_t> virtual_runtime;
+	//! The number of tasks of this producer that are waiting in the task queue
+	atomic<idx_t> pending_tasks;
+	//! The total time the tasks of this producer spent waiting in the task queue (in microseconds)
+	atomic<idx_t> scheduler_wait_time;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
 class TaskScheduler {
+	friend struct ProducerToken;
+
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
 
@@ -84,11 +120,32 @@ public:
 	//! Result do not need to be exact 'return 0' is a valid fallback strategy
 	static idx_t GetEstimatedCPUId();
 
+	//! Returns the number of NUMA nodes the scheduler distributes tasks over
+	idx_t NumberOfNUMANodes() const;
+	//! Returns the scheduling counters of the background worker threads
+	vector<SchedulerThreadInformation> GetThreadInformation();
+
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Returns the NUMA node of the calling thread
+	idx_t GetCurrentNUMANode();
+	void RemoveProducer(ProducerToken &producer);
+	//! Dequeues the next task to run on the given NUMA node, favoring the producer that received the least CPU time
+	//! relative to its priority
+	bool DequeueTask(ScheduledTask &task, idx_t node, bool &stolen);
+	//! Updates the scheduling statistics of the producer of a task that was taken from the task queue
+	void TaskDequeued(ScheduledTask &task);
+	//! Whether or not tasks of producers other than the given producer are waiting in the task queue
+	bool ShouldPreempt(ProducerToken &producer);
+	//! Executes a task that was dequeued from the task queue, returns true if the task finished
+	bool ExecuteTask(ScheduledTask &task);
 
 private:
 	DatabaseInstance &db;
+	//! The CPUs of each NUMA node that are available to this process (empty if there is only a single node)
+	vector<vector<idx_t>> numa_node_cpus;
+	//! Maps a CPU id to its NUMA node
+	vector<idx_t> cpu_numa_node;
 	//! The task queue
 	unique_ptr<ConcurrentQueue> queue;
 	//! Lock for modifying the thread count
@@ -105,6 +162,16 @@ private:
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
 	atomic<int32_t> current_thread_count;
+	//! Lock for the set of producers
+	mutex producers_lock;
+	//! The producers that are currently registered with the scheduler
+	reference_set_t<ProducerToken> producers;
+	//! The number of registered producers
+	atomic<idx_t> producer_count;
+	//! The number of producers that have tasks waiting in the task queue
+	atomic<idx_t> active_producers;
+	//! The lowest virtual runtime of the producers with waiting tasks (approximately)
+	atomic<idx_t> min_virtual_runtime;
 };
 
 } // namespace duckdb
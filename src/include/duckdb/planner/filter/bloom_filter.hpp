@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types.hpp"
+
+namespace duckdb {
+class Vector;
+class SelectionVector;
+struct UnifiedVectorFormat;
+
+//! BloomFilter is a blocked Bloom filter over the hashes of a set of values (e.g. the keys of a hash join build side).
+//! It can produce false positives, but never false negatives. NULL values never pass the filter.
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+	//! The number of bits that are reserved per key
+	static constexpr const idx_t BITS_PER_KEY = 16;
+
+public:
+	BloomFilter(LogicalType key_type, idx_t key_count);
+	BloomFilter(LogicalType key_type, vector<uint64_t> blocks);
+
+	//! The type of the keys that were inserted (hashes of different types are not comparable)
+	LogicalType key_type;
+	//! The 64-bit blocks of the filter - a key only ever sets bits within a single block. The count is a power of two.
+	vector<uint64_t> blocks;
+
+public:
+	//! Insert the (non-NULL) keys of the vector into the filter
+	void Insert(Vector &keys, idx_t count);
+	//! Writes the selected rows whose keys might be in the filter to result_sel, returns the result count
+	idx_t Lookup(Vector &keys, UnifiedVectorFormat &vdata, const SelectionVector &sel, idx_t approved_count,
+	             SelectionVector &result_sel) const;
+	//! Whether or not a key with the given hash might be in the filter
+	bool Contains(hash_t hash) const {
+		auto mask = GetMask(hash);
+		return (blocks[GetBlockIndex(hash)] & mask) == mask;
+	}
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	inline idx_t GetBlockIndex(hash_t hash) const {
+		return hash & (blocks.size() - 1);
+	}
+	//! The bits to set within a block, taken from the upper bits of the hash (the lower bits select the block)
+	static inline uint64_t GetMask(hash_t hash) {
+		return (1ULL << ((hash >> 40) & 63)) | (1ULL << ((hash >> 46) & 63)) | (1ULL << ((hash >> 52) & 63)) |
+		       (1ULL << ((hash >> 58) & 63));
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/in_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/value.hpp"
+
+namespace duckdb {
+class Vector;
+class SelectionVector;
+struct UnifiedVectorFormat;
+
+//! InFilter represents a "column IN (constant, constant, ...)" filter. NULL values never pass the filter.
+class InFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::IN_FILTER;
+
+public:
+	explicit InFilter(vector<Value> values);
+
+	//! The (sorted, unique and non-NULL) values to filter on
+	vector<Value> values;
+
+public:
+	//! Whether or not an IN filter can be created for values of the given type
+	static bool SupportsType(const LogicalType &type);
+	//! Writes the selected rows whose value is in the filter to result_sel, returns the result count
+	idx_t Select(Vector &vector, UnifiedVectorFormat &vdata, const SelectionVector &sel, idx_t approved_count,
+	             SelectionVector &result_sel) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -0,0 +1,37 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/optional_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+//! OptionalFilter wraps a filter that a scan can use to skip rows, segments or row groups, but does not have to
+//! evaluate. The filtered expression is still evaluated above the scan, so scans can ignore this filter.
+class OptionalFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::OPTIONAL_FILTER;
+
+public:
+	explicit OptionalFilter(unique_ptr<TableFilter> child_filter);
+
+	//! The wrapped filter
+	unique_ptr<TableFilter> child_filter;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -28,7 +28,10 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	BLOOM_FILTER = 6,   // bloom filter over the hashes of a set of values (e.g. the keys of a join build side)
+	IN_FILTER = 7,      // col IN (C1, C2, C3, ...)
+	OPTIONAL_FILTER = 8 // filter that scans can use for pruning, but do not have to evaluate
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/background_checkpointer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+
+#include <condition_variable>
+
+namespace duckdb {
+class DuckTransactionManager;
+
+//! The background checkpointer runs automatic checkpoints on a dedicated thread, so that the connection whose commit
+//! pushed the WAL over the checkpoint threshold does not have to wait for the checkpoint to finish
+class BackgroundCheckpointer {
+public:
+	//! The time to wait before retrying a checkpoint that could not obtain the checkpoint lock - doubled after every
+	//! failed attempt up to MAX_RETRY_INTERVAL_MS
+	static constexpr const int64_t INITIAL_RETRY_INTERVAL_MS = 10;
+	static constexpr const int64_t MAX_RETRY_INTERVAL_MS = 1000;
+
+	explicit BackgroundCheckpointer(DuckTransactionManager &transaction_manager);
+	~BackgroundCheckpointer();
+
+public:
+	//! Requests a checkpoint, starting the background thread if it is not running yet
+	void RequestCheckpoint();
+	//! Stops the background thread, waiting for a running checkpoint to finish. Pending requests are dropped.
+	void Stop();
+
+private:
+	void Run();
+
+private:
+	DuckTransactionManager &transaction_manager;
+	mutex lock;
+	std::condition_variable cv;
+	unique_ptr<thread> checkpoint_thread;
+	//! Whether a checkpoint has been requested that has not been performed yet
+	bool checkpoint_requested = false;
+	//! Whether the background checkpointer has been stopped
+	bool stopped = false;
+};
+
+} // namespace duckdb
@@ -14,6 +14,8 @@ struct MemoryInformation {
 struct TemporaryFileInformation {
 	string path;
 	idx_t size;
+	//! The size of the blocks stored in the file before compression
+	idx_t uncompressed_size;
 };
 
 } // namespace duckdb
@@ -37,6 +37,7 @@ public:
 	virtual BufferHandle Allocate(MemoryTag tag, idx_t block_size, bool can_destroy = true) = 0;
 	//! Reallocate an in-memory buffer that is pinned.
 	virtual void ReAllocate(shared_ptr<BlockHandle> &handle, idx_t block_size) = 0;
+	//! Pin a block. Returns an invalid BufferHandle if the block can be destroyed and was evicted.
 	virtual BufferHandle Pin(shared_ptr<BlockHandle> &handle) = 0;
 	//! Prefetch a series of blocks. Note that this is a performance suggestion.
 	virtual void Prefetch(vector<shared_ptr<BlockHandle>> &handles) = 0;
@@ -28,6 +28,11 @@ public:
 
 public:
 	void WriteTableData(Serializer &metadata_serializer);
+	//! Writes the row group data of the table - the first phase of WriteTableData. Row group data of different tables
+	//! can be written in parallel.
+	void WriteRowGroupData();
+	//! Writes the metadata of the table after WriteRowGroupData has been called - the second phase of WriteTableData
+	void FinalizeTableData(Serializer &metadata_serializer);
 
 	CompressionType GetColumnCompressionType(idx_t i);
 
@@ -44,12 +49,16 @@ protected:
 	DuckTableEntry &table;
 	//! Pointers to the start of each row group.
 	vector<RowGroupPointer> row_group_pointers;
+	//! The global statistics of a table whose row group data has been written by WriteRowGroupData
+	unique_ptr<TableStatistics> global_stats;
 };
 
 class SingleFileTableDataWriter : public TableDataWriter {
 public:
 	SingleFileTableDataWriter(SingleFileCheckpointWriter &checkpoint_manager, TableCatalogEntry &table,
 	                          MetadataWriter &table_data_writer);
+	SingleFileTableDataWriter(SingleFileCheckpointWriter &checkpoint_manager, TableCatalogEntry &table,
+	                          MetadataWriter &table_data_writer, PartialBlockManager &partial_block_manager);
 
 public:
 	void FinalizeTable(const TableStatistics &global_stats, DataTableInfo *info, Serializer &serializer) override;
@@ -60,6 +69,8 @@ private:
 	SingleFileCheckpointWriter &checkpoint_manager;
 	//! Writes the actual table data
 	MetadataWriter &table_data_writer;
+	//! The partial block manager that the row group data is written with
+	PartialBlockManager &partial_block_manager;
 };
 
 } // namespace duckdb
@@ -11,6 +11,8 @@
 #include "duckdb/storage/partial_block_manager.hpp"
 #include "duckdb/catalog/catalog_entry/index_catalog_entry.hpp"
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/reference_map.hpp"
+#include "duckdb/storage/storage_manager.hpp"
 
 namespace duckdb {
 class DatabaseInstance;
@@ -22,6 +24,7 @@ class SequenceCatalogEntry;
 class TableCatalogEntry;
 class ViewCatalogEntry;
 class TypeCatalogEntry;
+class StorageLockKey;
 
 class CheckpointWriter {
 public:
@@ -98,6 +101,7 @@ class SingleFileCheckpointWriter final : public CheckpointWriter {
 
 public:
 	SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager, CheckpointType checkpoint_type);
+	~SingleFileCheckpointWriter() override;
 
 	//! Checkpoint the current state of the WAL and flush it to the main storage. This should be called BEFORE any
 	//! connection is available because right now the checkpointing cannot be done online. (TODO)
@@ -111,10 +115,28 @@ public:
 	CheckpointType GetCheckpointType() const {
 		return checkpoint_type;
 	}
+	//! Returns the timing breakdown of the checkpoint
+	const CheckpointStatistics &GetStatistics() const {
+		return statistics;
+	}
 
 public:
 	void WriteTable(TableCatalogEntry &table, Serializer &serializer) override;
 
+private:
+	//! The row group data of a table that has been written, but whose metadata has not been written yet
+	struct PendingTableData {
+		//! The checkpoint lock of the table, held until the metadata of the table is written
+		unique_ptr<StorageLockKey> checkpoint_lock;
+		//! The partial block manager that the data of the table is written with
+		unique_ptr<PartialBlockManager> partial_block_manager;
+		unique_ptr<TableDataWriter> writer;
+	};
+
+	//! Writes the row group data of all tables in parallel. The metadata of the tables is written afterwards, in
+	//! catalog order, by WriteTable.
+	void WriteTableData(const catalog_entry_vector_t &catalog_entries);
+
 private:
 	//! The metadata writer is responsible for writing schema information
 	unique_ptr<MetadataWriter> metadata_writer;
@@ -127,6 +149,10 @@ private:
 	CheckpointType checkpoint_type;
 	//! Block usage count for verification purposes
 	unordered_map<block_id_t, idx_t> verify_block_usage_count;
+	//! The tables whose row group data has been written by WriteTableData
+	reference_map_t<TableCatalogEntry, PendingTableData> pending_tables;
+	//! The timing breakdown of the checkpoint
+	CheckpointStatistics statistics;
 };
 
 } // namespace duckdb
@@ -95,6 +95,9 @@ public:
 	//! Fetch data from the specific row identifiers from the base table
 	void Fetch(DuckTransaction &transaction, DataChunk &result, const vector<column_t> &column_ids,
 	           const Vector &row_ids, idx_t fetch_count, ColumnFetchState &state);
+	//! Selects the row identifiers that are visible to the transaction, without fetching any column data.
+	//! Returns the number of selected row identifiers.
+	idx_t SelectVisibleRows(DuckTransaction &transaction, const Vector &row_ids, idx_t count, SelectionVector &sel);
 
 	//! Initializes an append to transaction-local storage
 	void InitializeLocalAppend(LocalAppendState &state, TableCatalogEntry &table, ClientContext &context,
@@ -189,6 +192,10 @@ public:
 	unique_ptr<StorageLockKey> GetCheckpointLock();
 	//! Checkpoint the table to the specified table data writer
 	void Checkpoint(TableDataWriter &writer, Serializer &serializer);
+	//! Writes the row group data of the table - the first phase of Checkpoint
+	void WriteCheckpointData(TableDataWriter &writer, TableStatistics &global_stats);
+	//! Writes the row group, table and index metadata - the second phase of Checkpoint
+	void FinalizeCheckpoint(TableDataWriter &writer, TableStatistics &global_stats, Serializer &serializer);
 	void CommitDropTable();
 	void CommitDropColumn(idx_t index);
 
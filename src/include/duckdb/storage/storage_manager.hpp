@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -36,6 +37,10 @@ public:
 	virtual void RevertCommit() = 0;
 	// Make the commit persistent
 	virtual void FlushCommit() = 0;
+	//! Wait until the flushed commit is durable. Called after the commit has released the transaction locks, so that
+	//! concurrent commits can share a single sync of the WAL.
+	virtual void SyncCommit() {
+	}
 
 	virtual void AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
 	                             unique_ptr<PersistentCollectionData> row_group_data) = 0;
@@ -57,6 +62,42 @@ struct CheckpointOptions {
 	CheckpointType type;
 };
 
+//! The timing breakdown of a checkpoint
+struct CheckpointStatistics {
+	//! The number of tables that were checkpointed
+	idx_t table_count = 0;
+	//! The number of row groups that were written
+	idx_t row_group_count = 0;
+	//! The time spent writing the row group data of all tables (in parallel)
+	double write_data_seconds = 0;
+	//! The time spent writing the catalog and table metadata
+	double write_metadata_seconds = 0;
+	//! The time spent writing the header and truncating the file and the WAL
+	double finalize_seconds = 0;
+	//! The total time of the checkpoint
+	double total_seconds = 0;
+};
+
+//! Statistics on the WAL: how commits were made durable, and how the WAL was replayed when the database was opened
+struct WALStatistics {
+	//! The number of commits that were written to the WAL
+	idx_t commit_count = 0;
+	//! The number of times the WAL was synced to disk on behalf of commits
+	idx_t sync_count = 0;
+	//! The number of commits that were made durable by these syncs
+	idx_t synced_commit_count = 0;
+	//! The largest number of commits made durable by a single sync
+	idx_t max_batch_size = 0;
+	//! The total time spent syncing the WAL
+	double sync_seconds = 0;
+	//! The time since the database was attached
+	double elapsed_seconds = 0;
+	//! The number of bytes of WAL that were replayed when the database was opened
+	idx_t replayed_bytes = 0;
+	//! The time spent replaying the WAL
+	double replay_seconds = 0;
+};
+
 //! StorageManager is responsible for managing the physical storage of the
 //! database on disk
 class StorageManager {
@@ -104,6 +145,19 @@ public:
 	virtual vector<MetadataBlockInfo> GetMetadataInfo() = 0;
 	virtual shared_ptr<TableIOManager> GetTableIOManager(BoundCreateTableInfo *info) = 0;
 	virtual BlockManager &GetBlockManager() = 0;
+	//! Returns the statistics of the last checkpoint of this database, or false if there has been no checkpoint yet
+	virtual bool GetLastCheckpoint(CheckpointStatistics &result) {
+		return false;
+	}
+
+	//! Records a commit that was written to the WAL
+	void RegisterWALCommit();
+	//! Records a sync of the WAL that made the given number of commits durable
+	void RegisterWALSync(idx_t commit_count, double seconds);
+	//! Records the replay of the WAL when the database was opened
+	void RegisterWALReplay(idx_t bytes, double seconds);
+	//! Returns the statistics of the WAL since the database was attached
+	WALStatistics GetWALStatistics();
 
 protected:
 	virtual void LoadDatabase(const optional_idx block_alloc_size) = 0;
@@ -120,6 +174,11 @@ protected:
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
 	//! return nullptr when loading a database
 	bool load_complete = false;
+	//! Protects the WAL sync statistics
+	mutex wal_statistics_lock;
+	WALStatistics wal_statistics;
+	//! The time at which the database was attached
+	time_point<high_resolution_clock> attach_time;
 
 public:
 	template <class TARGET>
@@ -154,8 +213,14 @@ public:
 	vector<MetadataBlockInfo> GetMetadataInfo() override;
 	shared_ptr<TableIOManager> GetTableIOManager(BoundCreateTableInfo *info) override;
 	BlockManager &GetBlockManager() override;
+	bool GetLastCheckpoint(CheckpointStatistics &result) override;
 
 protected:
 	void LoadDatabase(const optional_idx block_alloc_size) override;
+
+private:
+	mutex checkpoint_statistics_lock;
+	//! The statistics of the last checkpoint, if any
+	unique_ptr<CheckpointStatistics> last_checkpoint;
 };
 } // namespace duckdb
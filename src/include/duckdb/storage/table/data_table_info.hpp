@@ -52,6 +52,14 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! Returns the commit id of the last transaction that committed changes to the data of the table
+	transaction_t GetLastCommitId() const {
+		return last_commit_id;
+	}
+	void SetLastCommitId(transaction_t commit_id) {
+		last_commit_id = commit_id;
+	}
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -69,6 +77,8 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! The commit id of the last transaction that committed changes to the data of the table
+	atomic<transaction_t> last_commit_id;
 };
 
 } // namespace duckdb
@@ -142,6 +142,13 @@ public:
 	//! Returns the number of committed rows (count - committed deletes)
 	idx_t GetCommittedRowCount();
 	RowGroupWriteData WriteToDisk(RowGroupWriter &writer);
+	//! Returns the compression types that the columns of the row group are written with
+	vector<CompressionType> GetCompressionTypes(RowGroupWriter &writer);
+	//! Sizes the write data for all columns of the row group, so that WriteColumnsToDisk can fill it in
+	void InitializeWriteData(RowGroupWriteData &write_data);
+	//! Writes the columns [column_start, column_end) to disk. Disjoint column ranges can be written in parallel.
+	void WriteColumnsToDisk(RowGroupWriteInfo &info, idx_t column_start, idx_t column_end,
+	                        RowGroupWriteData &write_data);
 	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer, TableStatistics &global_stats);
 	bool IsPersistent() const;
 	PersistentRowGroupData SerializeRowGroupInfo() const;
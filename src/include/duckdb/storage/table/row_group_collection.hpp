@@ -39,6 +39,7 @@ class RowGroupCollection {
 public:
 	RowGroupCollection(shared_ptr<DataTableInfo> info, BlockManager &block_manager, vector<LogicalType> types,
 	                   idx_t row_start, idx_t total_rows = 0);
+	~RowGroupCollection();
 
 public:
 	idx_t GetTotalRows() const;
@@ -70,6 +71,8 @@ public:
 
 	void Fetch(TransactionData transaction, DataChunk &result, const vector<column_t> &column_ids,
 	           const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state);
+	idx_t SelectVisibleRows(TransactionData transaction, const Vector &row_identifiers, idx_t count,
+	                        SelectionVector &sel);
 
 	//! Initialize an append of a variable number of rows. FinalizeAppend must be called after appending is done.
 	void InitializeAppend(TableAppendState &state);
@@ -96,12 +99,19 @@ public:
 	                  DataChunk &updates);
 
 	void Checkpoint(TableDataWriter &writer, TableStatistics &global_stats);
+	//! Writes the data of the row groups to disk (the first phase of Checkpoint). The global statistics must stay alive
+	//! until FinalizeCheckpoint is called.
+	void WriteCheckpointData(TableDataWriter &writer, TableStatistics &global_stats);
+	//! Writes the metadata of the row groups written by WriteCheckpointData (the second phase of Checkpoint)
+	void FinalizeCheckpoint();
 
 	void InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
 	                           vector<SegmentNode<RowGroup>> &segments);
 	bool ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state, idx_t segment_idx,
 	                         bool schedule_vacuum);
 	unique_ptr<CheckpointTask> GetCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t segment_idx);
+	//! Schedules the tasks that checkpoint a row group - the columns of wide row groups are checkpointed in parallel
+	void ScheduleCheckpointTasks(CollectionCheckpointState &checkpoint_state, idx_t segment_idx);
 
 	void CommitDropColumn(idx_t index);
 	void CommitDropTable();
@@ -152,6 +162,8 @@ private:
 	TableStatistics stats;
 	//! Allocation size, only tracked for appends
 	idx_t allocation_size;
+	//! The state of a checkpoint whose row group data has been written, but whose metadata has not been written yet
+	unique_ptr<CollectionCheckpointState> pending_checkpoint;
 };
 
 } // namespace duckdb
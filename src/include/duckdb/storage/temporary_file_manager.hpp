@@ -27,7 +27,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -37,6 +37,8 @@ public:
 	//! Returns true if the max_index has been altered
 	bool RemoveIndex(idx_t index);
 	idx_t GetMaxIndex();
+	//! Returns the number of indexes that are currently in use
+	idx_t GetIndexCount();
 	bool HasFreeBlocks();
 
 private:
@@ -48,6 +50,8 @@ private:
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
+	//! The size on disk of a single block index, used to register size changes with the manager
+	idx_t block_size;
 };
 
 //===--------------------------------------------------------------------===//
@@ -75,7 +79,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    idx_t buffer_size, TemporaryFileManager &manager);
 
 public:
 	struct TemporaryFileLock {
@@ -89,7 +93,14 @@ public:
 public:
 	TemporaryFileIndex TryGetBlockIndex();
 	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	void WriteTemporaryFile(AllocatedData &compressed_buffer, TemporaryFileIndex index);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
+	//! The size of the slots in this file
+	idx_t GetBufferSize() const {
+		return buffer_size;
+	}
+	//! Whether the slots in this file hold compressed buffers
+	bool IsCompressed() const;
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
@@ -104,6 +115,8 @@ private:
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
+	//! The size of a single slot in this file, either the block allocation size or a compressed size class
+	idx_t buffer_size;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
@@ -132,6 +145,12 @@ private:
 //===--------------------------------------------------------------------===//
 
 class TemporaryFileManager {
+public:
+	//! Compressed buffers are rounded up to a multiple of (block allocation size / COMPRESSED_SIZE_CLASSES)
+	static constexpr idx_t COMPRESSED_SIZE_CLASSES = 8;
+	//! The ZSTD compression level used for temporary buffers - negative levels favor speed over ratio
+	static constexpr int COMPRESSION_LEVEL = -3;
+
 public:
 	TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p);
 	~TemporaryFileManager();
@@ -164,6 +183,8 @@ private:
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
 	TemporaryFileIndex GetTempBlockIndex(TemporaryManagerLock &, block_id_t id);
 	void EraseFileHandle(TemporaryManagerLock &, idx_t file_index);
+	//! Compresses the buffer into compressed_buffer (if enabled and worthwhile), returns the size to write
+	idx_t CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer);
 
 private:
 	DatabaseInstance &db;
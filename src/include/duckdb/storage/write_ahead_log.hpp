@@ -15,11 +15,14 @@
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -112,8 +115,17 @@ public:
 	void Truncate(idx_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Write a flush marker and sync the WAL to disk
 	void Flush();
 
+	//! Write a flush marker and hand the entries to the OS without syncing them. Returns the position in the WAL up
+	//! to which the commit has been written.
+	idx_t WriteCommit();
+	//! Make the WAL durable up to (at least) the given position. Concurrent commits are synced as a group: one commit
+	//! syncs the WAL on behalf of every commit written before the sync started, the others wait for it to finish.
+	//! With wal_sync_mode = 'async' the sync is left to a background thread that runs every flush interval.
+	void SyncCommit(idx_t position);
+
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
 protected:
@@ -123,6 +135,34 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+
+private:
+	//! Sync everything written so far, called by the leader of a group commit with the sync lock held
+	void SyncWrittenEntries(unique_lock<mutex> &guard);
+	//! Sync the WAL periodically for asynchronous commits
+	void RunAsyncFlusher();
+	void StopAsyncFlusher();
+
+private:
+	//! Protects the group commit state below
+	mutex sync_lock;
+	//! Notified when a sync finishes
+	std::condition_variable sync_cv;
+	//! Notified when the asynchronous flusher needs to stop
+	std::condition_variable flusher_cv;
+	//! Whether a commit is currently syncing the WAL
+	bool sync_in_progress = false;
+	//! The position up to which commits have been written to the OS, and the number of commits written
+	idx_t written_position = 0;
+	idx_t written_commits = 0;
+	//! The position up to which the WAL is synced to disk, and the number of commits synced
+	idx_t synced_position = 0;
+	idx_t synced_commits = 0;
+	//! Set when syncing the WAL failed - the database is invalidated at that point
+	string sync_error;
+	//! The background thread that syncs asynchronous commits
+	unique_ptr<thread> async_flusher;
+	bool stop_async_flusher = false;
 };
 
 } // namespace duckdb
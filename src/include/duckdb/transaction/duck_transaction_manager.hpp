@@ -13,6 +13,7 @@
 #include "duckdb/common/enums/checkpoint_type.hpp"
 
 namespace duckdb {
+class BackgroundCheckpointer;
 class DuckTransaction;
 
 //! The Transaction Manager is responsible for creating and managing
@@ -33,6 +34,11 @@ public:
 	void RollbackTransaction(Transaction &transaction) override;
 
 	void Checkpoint(ClientContext &context, bool force = false) override;
+	//! Performs an automatic checkpoint on behalf of the background checkpointer. Returns false if the checkpoint lock
+	//! could not be obtained, in which case the checkpoint should be retried later.
+	bool TryBackgroundCheckpoint();
+	//! Stops the background checkpointer (if any) - called before the database is closed
+	void StopBackgroundCheckpointer();
 
 	transaction_t LowestActiveId() const {
 		return lowest_active_id;
@@ -67,6 +73,8 @@ protected:
 		bool can_checkpoint;
 		string reason;
 		CheckpointType type;
+		//! Whether the checkpoint is deferred to the background checkpointer
+		bool background_checkpoint = false;
 	};
 
 private:
@@ -80,6 +88,8 @@ private:
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
+	//! Requests a checkpoint from the background checkpointer
+	void RequestBackgroundCheckpoint();
 
 private:
 	//! The current start timestamp used by transactions
@@ -109,6 +119,10 @@ private:
 
 	atomic<idx_t> last_uncommitted_catalog_version = {TRANSACTION_ID_START};
 	idx_t last_committed_version = 0;
+	//! Lock protecting the creation of the background checkpointer
+	mutex background_checkpointer_lock;
+	//! Performs automatic checkpoints if background_checkpoint is enabled - created on first use
+	unique_ptr<BackgroundCheckpointer> background_checkpointer;
 
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
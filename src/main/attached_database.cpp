@@ -219,6 +219,10 @@ void AttachedDatabase::Close() {
 	if (!IsSystem() && !catalog->InMemory()) {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// stop the background checkpointer before the final checkpoint is written
+		DuckTransactionManager::Get(*this).StopBackgroundCheckpointer();
+	}
 
 	if (Exception::UncaughtException()) {
 		return;
@@ -20,9 +20,11 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
+#include "duckdb/main/result_cache.hpp"
 #include "duckdb/main/stream_query_result.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
@@ -299,6 +301,9 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	// we have a result collector - fetch the result directly from the result collector
 	result = executor.GetResult();
 	if (!create_stream_result) {
+		if (!prepared.result_cache_key.empty() && result->type == QueryResultType::MATERIALIZED_RESULT) {
+			ResultCache::Get(*this).StoreResult(*this, prepared, result->Cast<MaterializedQueryResult>().Collection());
+		}
 		CleanupInternal(lock, result.get(), false);
 	} else {
 		active_query->SetOpenResult(*result);
@@ -351,6 +356,9 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 #ifdef DEBUG
 	plan->Verify(*this);
 #endif
+	if (ResultCache::Get(*this).IsEnabled()) {
+		result->deterministic_result = ResultCache::PlanIsCacheable(*plan);
+	}
 	if (config.enable_optimizer && plan->RequireOptimizer()) {
 		profiler.StartPhase(MetricsType::ALL_OPTIMIZERS);
 		Optimizer optimizer(*planner.binder, *this);
@@ -655,8 +663,22 @@ unique_ptr<PreparedStatement> ClientContext::PrepareInternal(ClientContextLock &
 	auto statement_query = statement->query;
 	shared_ptr<PreparedStatementData> prepared_data;
 	auto unbound_statement = statement->Copy();
+	auto &plan_cache = PlanCache::Get(*this);
+	auto plan_cache_key = plan_cache.GetCacheKey(*this, *statement);
 	RunFunctionInTransactionInternal(
-	    lock, [&]() { prepared_data = CreatePreparedStatement(lock, statement_query, std::move(statement)); }, false);
+	    lock,
+	    [&]() {
+		    if (!plan_cache_key.empty()) {
+			    // check if another prepared statement has left behind a plan for this query
+			    prepared_data = plan_cache.GetPlan(*this, plan_cache_key);
+			    if (prepared_data) {
+				    return;
+			    }
+		    }
+		    prepared_data = CreatePreparedStatement(lock, statement_query, std::move(statement));
+		    prepared_data->plan_cache_key = std::move(plan_cache_key);
+	    },
+	    false);
 	prepared_data->unbound_statement = std::move(unbound_statement);
 	return make_uniq<PreparedStatement>(shared_from_this(), std::move(prepared_data), std::move(statement_query),
 	                                    std::move(named_param_map));
@@ -734,9 +756,21 @@ unique_ptr<QueryResult> ClientContext::Execute(const string &query, shared_ptr<P
 unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientContextLock &lock, const string &query,
                                                                        unique_ptr<SQLStatement> statement,
                                                                        const PendingQueryParameters &parameters) {
+	auto &result_cache = ResultCache::Get(*this);
+	auto result_cache_key = result_cache.GetCacheKey(*this, *statement);
+	if (!result_cache_key.empty()) {
+		// check if the result of this query is cached
+		auto cached_result = result_cache.GetResult(*this, result_cache_key);
+		if (cached_result) {
+			return PendingPreparedStatementInternal(lock, std::move(cached_result), parameters);
+		}
+	}
 	// prepare the query for execution
 	auto prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
 	                                        PreparedStatementMode::PREPARE_AND_EXECUTE);
+	if (!result_cache_key.empty() && prepared->deterministic_result) {
+		prepared->result_cache_key = std::move(result_cache_key);
+	}
 	idx_t parameter_count = !parameters.parameters ? 0 : parameters.parameters->size();
 	if (prepared->properties.parameter_count > 0 && parameter_count == 0) {
 		string error_message = StringUtil::Format("Expected %lld parameters, but none were supplied",
@@ -0,0 +1,165 @@
+#include "duckdb/main/plan_cache.hpp"
+
+#include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/sql_statement.hpp"
+
+namespace duckdb {
+
+PlanCache::PlanCache(DatabaseInstance &db) : db(db) {
+}
+
+PlanCache &PlanCache::Get(ClientContext &context) {
+	return context.db->GetPlanCache();
+}
+
+string PlanCache::GetStatementKey(ClientContext &context, SQLStatement &statement) {
+	auto &client_config = ClientConfig::GetConfig(context);
+	// the plan depends on the search path and on the settings of the connection that influence planning
+	// the key starts with the statement itself, separated from the settings by a NULL byte
+	string key = statement.ToString();
+	key += '\0';
+	key += CatalogSearchEntry::ListToString(ClientData::Get(context).catalog_search_path->Get());
+	key += "," + to_string(client_config.enable_optimizer) + to_string(client_config.enable_caching_operators) +
+	       to_string(client_config.force_no_cross_product) + to_string(client_config.force_asof_iejoin) +
+	       to_string(client_config.prefer_range_joins) + to_string(client_config.integer_division) +
+	       to_string(client_config.ieee_floating_point_ops) + to_string(client_config.order_by_non_integer_literal) +
+	       to_string(client_config.preserve_identifier_case) +
+	       to_string(client_config.scalar_subquery_error_on_multiple_rows);
+	key += "," + to_string(client_config.perfect_ht_threshold) + "," +
+	       to_string(client_config.ordered_aggregate_threshold) + "," +
+	       to_string(client_config.nested_loop_join_threshold) + "," + to_string(client_config.merge_join_threshold);
+	auto &db_config = DBConfig::GetConfig(context);
+	key += "," + db_config.options.collation + "," + to_string(static_cast<uint8_t>(db_config.options.default_order_type)) +
+	       to_string(static_cast<uint8_t>(db_config.options.default_null_order));
+	// extension settings (e.g. the time zone) and variables can change the bound plan as well
+	vector<string> variables;
+	for (auto &entry : client_config.set_variables) {
+		variables.push_back("set:" + entry.first + "=" + entry.second.ToSQLString());
+	}
+	for (auto &entry : client_config.user_variables) {
+		variables.push_back("var:" + entry.first + "=" + entry.second.ToSQLString());
+	}
+	std::sort(variables.begin(), variables.end());
+	key += "," + StringUtil::Join(variables, ",");
+	return key;
+}
+
+string PlanCache::GetCacheKey(ClientContext &context, SQLStatement &statement) {
+	auto &config = DBConfig::GetConfig(db);
+	if (config.options.plan_cache_size == 0) {
+		return string();
+	}
+	if (statement.type != StatementType::SELECT_STATEMENT || ClientConfig::GetConfig(context).query_verification_enabled) {
+		return string();
+	}
+	return GetStatementKey(context, statement);
+}
+
+shared_ptr<PreparedStatementData> PlanCache::GetPlan(ClientContext &context, const string &key) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key);
+	if (entry == entries.end()) {
+		PlanCacheEntry new_entry;
+		new_entry.query = key.substr(0, key.find('\0'));
+		new_entry.misses = 1;
+		new_entry.last_used = ++current_use;
+		EvictEntries(DBConfig::GetConfig(db).options.plan_cache_size - 1);
+		entries.insert(make_pair(key, std::move(new_entry)));
+		return nullptr;
+	}
+	auto &cache_entry = entry->second;
+	cache_entry.last_used = ++current_use;
+	while (!cache_entry.plans.empty()) {
+		auto plan = std::move(cache_entry.plans.back());
+		cache_entry.plans.pop_back();
+		bool catalogs_are_current;
+		try {
+			catalogs_are_current = plan->CatalogsAreCurrent(context);
+		} catch (std::exception &ex) {
+			// e.g. a database the plan reads from was detached
+			catalogs_are_current = false;
+		}
+		if (catalogs_are_current) {
+			cache_entry.hits++;
+			return plan;
+		}
+		// the catalog was changed since this plan was created - discard it
+	}
+	cache_entry.misses++;
+	return nullptr;
+}
+
+bool PlanCache::PlanIsShareable(const PhysicalOperator &op) {
+	if (op.type == PhysicalOperatorType::TABLE_SCAN) {
+		// only scans of tables are shared - other table functions can hold on to connection specific state
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if (scan.function.name != "seq_scan" && scan.function.name != "index_scan") {
+			return false;
+		}
+	}
+	for (auto &child : op.GetChildren()) {
+		if (!PlanIsShareable(child.get())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void PlanCache::ReturnPlan(shared_ptr<PreparedStatementData> plan) {
+	D_ASSERT(!plan->plan_cache_key.empty());
+	if (!plan->plan || !plan->properties.bound_all_parameters || plan->properties.always_require_rebind ||
+	    !PlanIsShareable(*plan->plan)) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(plan->plan_cache_key);
+	if (entry == entries.end()) {
+		// the entry was evicted in the mean time
+		return;
+	}
+	auto &cache_entry = entry->second;
+	if (cache_entry.plans.size() >= MAX_PLANS_PER_QUERY) {
+		return;
+	}
+	cache_entry.plans.push_back(std::move(plan));
+}
+
+void PlanCache::EvictEntries(idx_t max_entries) {
+	while (entries.size() > max_entries) {
+		auto lru_entry = entries.begin();
+		for (auto it = entries.begin(); it != entries.end(); it++) {
+			if (it->second.last_used < lru_entry->second.last_used) {
+				lru_entry = it;
+			}
+		}
+		entries.erase(lru_entry);
+	}
+}
+
+void PlanCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	entries.clear();
+}
+
+vector<PlanCacheInformation> PlanCache::GetInformation() {
+	lock_guard<mutex> guard(lock);
+	vector<PlanCacheInformation> result;
+	for (auto &entry : entries) {
+		PlanCacheInformation info;
+		info.query = entry.second.query;
+		info.hits = entry.second.hits;
+		info.misses = entry.second.misses;
+		info.cached_plans = entry.second.plans.size();
+		result.push_back(std::move(info));
+	}
+	return result;
+}
+
+} // namespace duckdb
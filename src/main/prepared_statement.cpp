@@ -1,6 +1,7 @@
 #include "duckdb/main/prepared_statement.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/prepared_statement_data.hpp"
 
 namespace duckdb {
@@ -16,6 +17,14 @@ PreparedStatement::PreparedStatement(ErrorData error) : context(nullptr), succes
 }
 
 PreparedStatement::~PreparedStatement() {
+	if (!context || !data || data->plan_cache_key.empty() || data.use_count() != 1) {
+		return;
+	}
+	// nobody else is using the plan anymore - hand it to the plan cache so it can be reused
+	try {
+		PlanCache::Get(*context).ReturnPlan(std::move(data));
+	} catch (...) { // LCOV_EXCL_START
+	} // LCOV_EXCL_STOP
 }
 
 const string &PreparedStatement::GetError() {
@@ -66,17 +66,21 @@ bool PreparedStatementData::RequireRebind(ClientContext &context,
 		}
 	}
 	// Check the catalog versions to ensure all catalog entries we rely on are current
+	return !CatalogsAreCurrent(context);
+}
+
+bool PreparedStatementData::CatalogsAreCurrent(ClientContext &context) {
 	for (auto &it : properties.read_databases) {
 		if (!CheckCatalogIdentity(context, it.first, it.second)) {
-			return true;
+			return false;
 		}
 	}
 	for (auto &it : properties.modified_databases) {
 		if (!CheckCatalogIdentity(context, it.first, it.second)) {
-			return true;
+			return false;
 		}
 	}
-	return false;
+	return true;
 }
 
 void PreparedStatementData::Bind(case_insensitive_map_t<BoundParameterData> values) {
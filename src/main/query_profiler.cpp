@@ -116,6 +116,7 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	case PhysicalOperatorType::CROSS_PRODUCT:
 	case PhysicalOperatorType::PIECEWISE_MERGE_JOIN:
 	case PhysicalOperatorType::IE_JOIN:
+	case PhysicalOperatorType::INDEX_JOIN:
 	case PhysicalOperatorType::LEFT_DELIM_JOIN:
 	case PhysicalOperatorType::RIGHT_DELIM_JOIN:
 	case PhysicalOperatorType::UNION:
@@ -191,6 +192,9 @@ void QueryProfiler::EndQuery() {
 			if (info.Enabled(MetricsType::BLOCKED_THREAD_TIME)) {
 				info.metrics[MetricsType::BLOCKED_THREAD_TIME] = query_info.blocked_thread_time;
 			}
+			if (info.Enabled(MetricsType::SCHEDULER_WAIT_TIME)) {
+				info.metrics[MetricsType::SCHEDULER_WAIT_TIME] = query_info.scheduler_wait_time;
+			}
 			if (info.Enabled(MetricsType::OPERATOR_TIMING)) {
 				info.metrics[MetricsType::OPERATOR_TIMING] = main_query.Elapsed();
 			}
@@ -414,17 +418,29 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 		if (profiler.HasOperatorSetting(MetricsType::RESULT_SET_SIZE)) {
 			tree_node.GetProfilingInfo().AddToMetric<idx_t>(MetricsType::RESULT_SET_SIZE, node.second.result_set_size);
 		}
+		if (op.type == PhysicalOperatorType::TABLE_SCAN && op.Cast<PhysicalTableScan>().dynamic_filters) {
+			// joins push their filters into the scan during execution - render them as well
+			auto &info = tree_node.GetProfilingInfo();
+			if (info.Enabled(MetricsType::EXTRA_INFO)) {
+				info.extra_info = op.ParamsToString();
+			}
+		}
 	}
 	profiler.timings.clear();
 }
 
-void QueryProfiler::SetInfo(const double &blocked_thread_time) {
+void QueryProfiler::SetInfo(const double &blocked_thread_time, const double &scheduler_wait_time) {
 	lock_guard<mutex> guard(flush_lock);
-	if (!IsEnabled() || !running || !root->GetProfilingInfo().Enabled(MetricsType::BLOCKED_THREAD_TIME)) {
+	if (!IsEnabled() || !running) {
 		return;
 	}
-
-	query_info.blocked_thread_time = blocked_thread_time;
+	auto &info = root->GetProfilingInfo();
+	if (info.Enabled(MetricsType::BLOCKED_THREAD_TIME)) {
+		query_info.blocked_thread_time = blocked_thread_time;
+	}
+	if (info.Enabled(MetricsType::SCHEDULER_WAIT_TIME)) {
+		query_info.scheduler_wait_time = scheduler_wait_time;
+	}
 }
 
 string QueryProfiler::DrawPadded(const string &str, idx_t width) {
@@ -689,7 +705,7 @@ profiler_settings_t EraseQueryRootSettings(profiler_settings_t settings) {
 
 	for (auto &setting : settings) {
 		if (MetricsUtils::IsOptimizerMetric(setting) || MetricsUtils::IsPhaseTimingMetric(setting) ||
-		    setting == MetricsType::BLOCKED_THREAD_TIME) {
+		    setting == MetricsType::BLOCKED_THREAD_TIME || setting == MetricsType::SCHEDULER_WAIT_TIME) {
 			phase_timing_settings_to_erase.insert(setting);
 		}
 	}
@@ -0,0 +1,284 @@
+#include "duckdb/main/result_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/sql_statement.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/meta_transaction.hpp"
+
+namespace duckdb {
+
+ResultCache::ResultCache(DatabaseInstance &db, idx_t memory_limit) : db(db), memory_limit(memory_limit) {
+}
+
+ResultCache &ResultCache::Get(ClientContext &context) {
+	return context.db->GetResultCache();
+}
+
+void ResultCache::SetMemoryLimit(idx_t limit) {
+	lock_guard<mutex> guard(lock);
+	memory_limit = limit;
+	EvictEntries(0);
+}
+
+string ResultCache::GetCacheKey(ClientContext &context, SQLStatement &statement) {
+	if (!IsEnabled() || statement.type != StatementType::SELECT_STATEMENT || !statement.named_param_map.empty()) {
+		return string();
+	}
+	if (ClientConfig::GetConfig(context).AnyVerification()) {
+		return string();
+	}
+	if (!DBConfig::GetConfig(context).options.preserve_insertion_order) {
+		// cached results are returned in insertion order - which is not guaranteed when it is not preserved
+		return string();
+	}
+	return PlanCache::GetStatementKey(context, statement);
+}
+
+bool ResultCache::PlanIsCacheable(LogicalOperator &op) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		// only the contents of tables are tracked - other table functions can read anything
+		auto &get = op.Cast<LogicalGet>();
+		if (get.function.name != "seq_scan" && get.function.name != "index_scan") {
+			return false;
+		}
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+		return false;
+	default:
+		break;
+	}
+	bool is_consistent = true;
+	LogicalOperatorVisitor::EnumerateExpressions(op, [&](unique_ptr<Expression> *expr) {
+		// functions such as random() or now() return different results for every query
+		if (!(*expr)->IsConsistent()) {
+			is_consistent = false;
+		}
+	});
+	if (!is_consistent) {
+		return false;
+	}
+	for (auto &child : op.children) {
+		if (!PlanIsCacheable(*child)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ResultCache::GetScannedTables(const PhysicalOperator &op, vector<shared_ptr<DataTableInfo>> &result) {
+	switch (op.type) {
+	case PhysicalOperatorType::TABLE_SCAN: {
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if (!scan.bind_data || (scan.function.name != "seq_scan" && scan.function.name != "index_scan")) {
+			return false;
+		}
+		auto &bind_data = scan.bind_data->Cast<TableScanBindData>();
+		result.push_back(bind_data.table.GetStorage().GetDataTableInfo());
+		break;
+	}
+	case PhysicalOperatorType::POSITIONAL_SCAN:
+		// the scanned tables are not children of the positional scan
+		return false;
+	default:
+		break;
+	}
+	for (auto &child : op.GetChildren()) {
+		if (!GetScannedTables(child.get(), result)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ResultCache::TablesAreCurrent(ClientContext &context, ResultCacheEntry &entry, bool &stale) {
+	stale = false;
+	for (auto &table : entry.tables) {
+		auto last_commit_id = table.info->GetLastCommitId();
+		if (last_commit_id != table.commit_id) {
+			// changes were committed to the table after the result was computed
+			stale = true;
+			return false;
+		}
+		auto &transaction = DuckTransaction::Get(context, table.info->GetDB());
+		if (last_commit_id >= transaction.start_time) {
+			// the result reflects changes that the current transaction cannot see
+			return false;
+		}
+	}
+	return true;
+}
+
+shared_ptr<PreparedStatementData> ResultCache::GetResult(ClientContext &context, const string &key) {
+	if (MetaTransaction::Get(context).ModifiedDatabase()) {
+		// the transaction has local changes that are not reflected by cached results
+		return nullptr;
+	}
+	auto result = make_shared_ptr<PreparedStatementData>(StatementType::SELECT_STATEMENT);
+	BufferHandle handle;
+	idx_t size;
+	idx_t row_count;
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = entries.find(key);
+		if (entry == entries.end()) {
+			return nullptr;
+		}
+		auto &cache_entry = entry->second;
+		result->properties = cache_entry.properties;
+		bool catalogs_are_current;
+		try {
+			catalogs_are_current = result->CatalogsAreCurrent(context);
+		} catch (std::exception &ex) {
+			// e.g. a database the query reads from was detached
+			catalogs_are_current = false;
+		}
+		if (!catalogs_are_current) {
+			RemoveEntry(entry);
+			return nullptr;
+		}
+		bool stale;
+		if (!TablesAreCurrent(context, cache_entry, stale)) {
+			if (stale) {
+				RemoveEntry(entry);
+			}
+			return nullptr;
+		}
+		handle = BufferManager::GetBufferManager(db).Pin(cache_entry.block);
+		if (!handle.IsValid()) {
+			// the result was evicted by the buffer pool
+			RemoveEntry(entry);
+			return nullptr;
+		}
+		cache_entry.last_used = ++current_use;
+		result->names = cache_entry.names;
+		result->types = cache_entry.types;
+		size = cache_entry.size;
+		row_count = cache_entry.row_count;
+	}
+	// deserialize the cached result and scan it instead of running the query
+	auto collection = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(db), result->types);
+	MemoryStream stream(handle.Ptr(), size);
+	BinaryDeserializer deserializer(stream);
+	deserializer.Begin();
+	deserializer.ReadList(100, "chunks", [&](Deserializer::List &list, idx_t i) {
+		list.ReadObject([&](Deserializer &object) {
+			DataChunk chunk;
+			chunk.Deserialize(object);
+			collection->Append(chunk);
+		});
+	});
+	deserializer.End();
+	result->plan = make_uniq<PhysicalColumnDataScan>(result->types, PhysicalOperatorType::COLUMN_DATA_SCAN, row_count,
+	                                                 std::move(collection));
+	return result;
+}
+
+void ResultCache::StoreResult(ClientContext &context, PreparedStatementData &prepared,
+                              ColumnDataCollection &collection) {
+	D_ASSERT(!prepared.result_cache_key.empty());
+	if (!prepared.plan || MetaTransaction::Get(context).ModifiedDatabase()) {
+		return;
+	}
+	if (collection.SizeInBytes() > memory_limit) {
+		return;
+	}
+	ResultCacheEntry entry;
+	vector<shared_ptr<DataTableInfo>> tables;
+	if (!GetScannedTables(*prepared.plan, tables)) {
+		return;
+	}
+	for (auto &info : tables) {
+		auto commit_id = info->GetLastCommitId();
+		auto &transaction = DuckTransaction::Get(context, info->GetDB());
+		if (commit_id >= transaction.start_time) {
+			// changes were committed to the table that this query could not see
+			return;
+		}
+		ResultCacheTable table;
+		table.info = info;
+		table.commit_id = commit_id;
+		entry.tables.push_back(std::move(table));
+	}
+	entry.properties = prepared.properties;
+	entry.names = prepared.names;
+	entry.types = prepared.types;
+	entry.row_count = collection.Count();
+
+	// serialize the result into a buffer that the buffer pool can destroy when it needs the memory
+	MemoryStream stream;
+	BinarySerializer serializer(stream);
+	serializer.Begin();
+	serializer.WriteList(100, "chunks", collection.ChunkCount(), [&](Serializer::List &list, idx_t i) {
+		DataChunk chunk;
+		collection.InitializeScanChunk(chunk);
+		collection.FetchChunk(i, chunk);
+		list.WriteObject([&](Serializer &object) { chunk.Serialize(object); });
+	});
+	serializer.End();
+	entry.size = stream.GetPosition();
+	if (entry.size > memory_limit) {
+		return;
+	}
+	BufferHandle handle;
+	try {
+		handle = BufferManager::GetBufferManager(db).Allocate(MemoryTag::RESULT_CACHE, entry.size, true);
+	} catch (OutOfMemoryException &ex) {
+		// there is no room for the result in the buffer pool - the query itself succeeded
+		return;
+	}
+	memcpy(handle.Ptr(), stream.GetData(), entry.size);
+	entry.block = handle.GetBlockHandle();
+
+	lock_guard<mutex> guard(lock);
+	auto existing_entry = entries.find(prepared.result_cache_key);
+	if (existing_entry != entries.end()) {
+		RemoveEntry(existing_entry);
+	}
+	EvictEntries(entry.size);
+	if (memory_usage + entry.size > memory_limit) {
+		// the memory limit was lowered in the mean time
+		return;
+	}
+	entry.last_used = ++current_use;
+	memory_usage += entry.size;
+	entries.insert(make_pair(prepared.result_cache_key, std::move(entry)));
+}
+
+void ResultCache::RemoveEntry(unordered_map<string, ResultCacheEntry>::iterator entry) {
+	D_ASSERT(memory_usage >= entry->second.size);
+	memory_usage -= entry->second.size;
+	entries.erase(entry);
+}
+
+void ResultCache::EvictEntries(idx_t required_memory) {
+	while (!entries.empty() && memory_usage + required_memory > memory_limit) {
+		auto lru_entry = entries.begin();
+		for (auto it = entries.begin(); it != entries.end(); it++) {
+			if (it->second.last_used < lru_entry->second.last_used) {
+				lru_entry = it;
+			}
+		}
+		RemoveEntry(lru_entry);
+	}
+}
+
+} // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/main/settings.hpp"
 
 #include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -8,6 +9,8 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/result_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
@@ -95,6 +98,22 @@ Value CatalogErrorMaxSchema::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.options.catalog_error_max_schemas);
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = BooleanValue::Get(input);
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -112,6 +131,56 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// WAL Sync Mode
+//===--------------------------------------------------------------------===//
+void WALSyncModeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto sync_mode = StringUtil::Lower(input.ToString());
+	if (sync_mode == "sync") {
+		config.options.wal_sync_mode = WALSyncMode::SYNC;
+	} else if (sync_mode == "async") {
+		config.options.wal_sync_mode = WALSyncMode::ASYNC;
+	} else {
+		throw ParserException("Unrecognized option for wal_sync_mode, expected sync or async");
+	}
+}
+
+void WALSyncModeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_sync_mode = DBConfig().options.wal_sync_mode;
+}
+
+Value WALSyncModeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.wal_sync_mode) {
+	case WALSyncMode::SYNC:
+		return "sync";
+	case WALSyncMode::ASYNC:
+		return "async";
+	default:
+		throw InternalException("Type not implemented for WALSyncMode");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Async Flush Interval
+//===--------------------------------------------------------------------===//
+void WALAsyncFlushIntervalSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto interval = input.GetValue<uint64_t>();
+	if (interval == 0) {
+		throw InvalidInputException("wal_async_flush_interval must be at least 1 millisecond");
+	}
+	config.options.wal_async_flush_interval = interval;
+}
+
+void WALAsyncFlushIntervalSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_async_flush_interval = DBConfig().options.wal_async_flush_interval;
+}
+
+Value WALAsyncFlushIntervalSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_async_flush_interval);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -1576,6 +1645,28 @@ Value PivotLimitSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(ClientConfig::GetConfig(context).pivot_limit));
 }
 
+//===--------------------------------------------------------------------===//
+// Plan Cache Size
+//===--------------------------------------------------------------------===//
+void PlanCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.plan_cache_size = input.GetValue<uint64_t>();
+	if (db) {
+		db->GetPlanCache().Clear();
+	}
+}
+
+void PlanCacheSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.plan_cache_size = DBConfig().options.plan_cache_size;
+	if (db) {
+		db->GetPlanCache().Clear();
+	}
+}
+
+Value PlanCacheSizeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.plan_cache_size);
+}
+
 //===--------------------------------------------------------------------===//
 // PreserveIdentifierCase
 //===--------------------------------------------------------------------===//
@@ -1679,6 +1770,54 @@ Value ProduceArrowStringView::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(DBConfig::GetConfig(context).options.produce_arrow_string_views);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Priority
+//===--------------------------------------------------------------------===//
+void QueryPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	static constexpr const idx_t MAX_QUERY_PRIORITY = 10000;
+	auto priority = input.GetValue<uint64_t>();
+	if (priority == 0 || priority > MAX_QUERY_PRIORITY) {
+		throw InvalidInputException("query_priority must be between 1 and %llu", MAX_QUERY_PRIORITY);
+	}
+	ClientConfig::GetConfig(context).query_priority = priority;
+}
+
+void QueryPrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_priority = ClientConfig().query_priority;
+}
+
+Value QueryPrioritySetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).query_priority);
+}
+
+//===--------------------------------------------------------------------===//
+// Result Cache Memory Limit
+//===--------------------------------------------------------------------===//
+void ResultCacheMemoryLimitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto limit_str = input.ToString();
+	uint64_t limit;
+	if (!TryCast::Operation<string_t, uint64_t>(string_t(limit_str), limit, true)) {
+		// not a plain number of bytes (e.g. '0' to disable the cache) - parse it with a unit (e.g. '64MB')
+		limit = DBConfig::ParseMemoryLimit(limit_str);
+	}
+	config.options.result_cache_memory_limit = limit;
+	if (db) {
+		db->GetResultCache().SetMemoryLimit(config.options.result_cache_memory_limit);
+	}
+}
+
+void ResultCacheMemoryLimitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.result_cache_memory_limit = DBConfig().options.result_cache_memory_limit;
+	if (db) {
+		db->GetResultCache().SetMemoryLimit(config.options.result_cache_memory_limit);
+	}
+}
+
+Value ResultCacheMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.result_cache_memory_limit));
+}
+
 //===--------------------------------------------------------------------===//
 // ScalarSubqueryErrorOnMultipleRows
 //===--------------------------------------------------------------------===//
@@ -1862,6 +2001,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -394,6 +394,7 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
 		this->producer = scheduler.CreateProducer();
+		this->producer->SetPriority(ClientConfig::GetConfig(context).query_priority);
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -680,7 +681,9 @@ void Executor::Flush(ThreadContext &thread_context) {
 		global_profiler->Flush(thread_context.profiler);
 
 		auto blocked_time = blocked_thread_time.load();
-		global_profiler->SetInfo(double(blocked_time * WAIT_TIME_MS.count()) / 1000);
+		auto scheduler_wait_time = producer ? producer->GetSchedulerWaitTime() : 0;
+		global_profiler->SetInfo(double(blocked_time * WAIT_TIME_MS.count()) / 1000,
+		                         double(scheduler_wait_time) / 1000000);
 	}
 }
 
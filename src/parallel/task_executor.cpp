@@ -61,8 +61,8 @@ BaseExecutorTask::BaseExecutorTask(TaskExecutor &executor) : executor(executor)
 }
 
 TaskExecutionResult BaseExecutorTask::Execute(TaskExecutionMode mode) {
+	// these tasks cannot be split up - they always run to completion, also in PROCESS_PARTIAL mode
 	(void)mode;
-	D_ASSERT(mode == TaskExecutionMode::PROCESS_ALL);
 	if (executor.HasError()) {
 		// another task encountered an error - bailout
 		executor.FinishTask();
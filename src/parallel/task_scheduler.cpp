@@ -1,8 +1,12 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -23,65 +27,128 @@
 #include <unistd.h>
 #endif
 
+#if !defined(DUCKDB_NO_THREADS) && defined(__linux__) && defined(_GNU_SOURCE) && !defined(DUCKDB_WASM)
+#define DUCKDB_NUMA_AWARE_SCHEDULING
+#include <pthread.h>
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
 #ifndef DUCKDB_NO_THREADS
-	explicit SchedulerThread(unique_ptr<thread> thread_p) : internal_thread(std::move(thread_p)) {
+	SchedulerThread(idx_t thread_id, idx_t numa_node)
+	    : thread_id(thread_id), numa_node(numa_node), pinned(false), tasks_executed(0), tasks_stolen(0),
+	      idle_wakeups(0) {
 	}
 
 	unique_ptr<thread> internal_thread;
+	idx_t thread_id;
+	idx_t numa_node;
+	//! The CPUs the thread should be pinned to (empty if the thread is not pinned)
+	vector<idx_t> cpus;
+	atomic<bool> pinned;
+	atomic<idx_t> tasks_executed;
+	atomic<idx_t> tasks_stolen;
+	atomic<idx_t> idle_wakeups;
 #endif
 };
 
+//! A task that is waiting in the task queue
+struct ScheduledTask {
+	shared_ptr<Task> task;
+	//! The producer that scheduled the task - a producer outlives the tasks it schedules
+	optional_ptr<ProducerToken> producer;
+	//! The time at which the task was scheduled
+	std::chrono::steady_clock::time_point scheduled_time;
+};
+
 #ifndef DUCKDB_NO_THREADS
-typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
+typedef duckdb_moodycamel::ConcurrentQueue<ScheduledTask> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
+//! The worker thread that is running on the current thread (if any)
+static thread_local SchedulerThread *current_scheduler_thread = nullptr;
+
+//! The task queue keeps a separate queue per NUMA node. Tasks are enqueued on the node of the thread that schedules
+//! them, and threads prefer to take tasks from the queue of their own node - only stealing tasks from the queues of
+//! other nodes when their own queue is empty. All queues share a single semaphore, so that idle threads are woken up
+//! regardless of the node that a task is scheduled on.
 struct ConcurrentQueue {
-	concurrent_queue_t q;
+	explicit ConcurrentQueue(idx_t node_count) {
+		for (idx_t node = 0; node < node_count; node++) {
+			queues.push_back(make_uniq<concurrent_queue_t>());
+		}
+	}
+
+	vector<unique_ptr<concurrent_queue_t>> queues;
 	lightweight_semaphore_t semaphore;
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	void Enqueue(ProducerToken &token, ScheduledTask task, idx_t node);
+	bool DequeueFromProducer(ProducerToken &token, ScheduledTask &task, idx_t node);
+	//! Dequeues a task, preferring the queue of the given node - "stolen" is set if it came from another node
+	bool Dequeue(ScheduledTask &task, idx_t node, bool &stolen);
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	explicit QueueProducerToken(ConcurrentQueue &queue) {
+		for (auto &q : queue.queues) {
+			queue_tokens.push_back(make_uniq<duckdb_moodycamel::ProducerToken>(*q));
+		}
 	}
 
-	duckdb_moodycamel::ProducerToken queue_token;
+	vector<unique_ptr<duckdb_moodycamel::ProducerToken>> queue_tokens;
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+void ConcurrentQueue::Enqueue(ProducerToken &token, ScheduledTask task, idx_t node) {
+	D_ASSERT(node < queues.size());
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
+	if (queues[node]->enqueue(*token.token->queue_tokens[node], std::move(task))) {
 		semaphore.signal();
 	} else {
 		throw InternalException("Could not schedule task!");
 	}
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, ScheduledTask &task, idx_t node) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	for (idx_t i = 0; i < queues.size(); i++) {
+		auto queue_idx = (node + i) % queues.size();
+		if (queues[queue_idx]->try_dequeue_from_producer(*token.token->queue_tokens[queue_idx], task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::Dequeue(ScheduledTask &task, idx_t node, bool &stolen) {
+	for (idx_t i = 0; i < queues.size(); i++) {
+		if (queues[(node + i) % queues.size()]->try_dequeue(task)) {
+			stolen = i > 0;
+			return true;
+		}
+	}
+	return false;
 }
 
 #else
 struct ConcurrentQueue {
-	reference_map_t<QueueProducerToken, std::queue<shared_ptr<Task>>> q;
+	explicit ConcurrentQueue(idx_t node_count) {
+	}
+
+	reference_map_t<QueueProducerToken, std::queue<ScheduledTask>> q;
 	mutex qlock;
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	void Enqueue(ProducerToken &token, ScheduledTask task, idx_t node);
+	bool DequeueFromProducer(ProducerToken &token, ScheduledTask &task, idx_t node);
+	bool Dequeue(ScheduledTask &task, idx_t node, bool &stolen);
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+void ConcurrentQueue::Enqueue(ProducerToken &token, ScheduledTask task, idx_t node) {
 	lock_guard<mutex> lock(qlock);
 	q[std::ref(*token.token)].push(std::move(task));
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, ScheduledTask &task, idx_t node) {
 	lock_guard<mutex> lock(qlock);
 	D_ASSERT(!q.empty());
 
@@ -96,6 +163,19 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 	return true;
 }
 
+bool ConcurrentQueue::Dequeue(ScheduledTask &task, idx_t node, bool &stolen) {
+	lock_guard<mutex> lock(qlock);
+	stolen = false;
+	for (auto &entry : q) {
+		if (!entry.second.empty()) {
+			task = std::move(entry.second.front());
+			entry.second.pop();
+			return true;
+		}
+	}
+	return false;
+}
+
 struct QueueProducerToken {
 	explicit QueueProducerToken(ConcurrentQueue &queue) : queue(&queue) {
 	}
@@ -111,18 +191,115 @@ private:
 #endif
 
 ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+    : scheduler(scheduler), token(std::move(token)), priority(DEFAULT_PRIORITY), virtual_runtime(0),
+      pending_tasks(0), scheduler_wait_time(0) {
 }
 
 ProducerToken::~ProducerToken() {
+	scheduler.RemoveProducer(*this);
+}
+
+void ProducerToken::SetPriority(idx_t new_priority) {
+	priority = MaxValue<idx_t>(new_priority, 1);
+}
+
+idx_t ProducerToken::GetSchedulerWaitTime() const {
+	return scheduler_wait_time;
+}
+
+#ifdef DUCKDB_NUMA_AWARE_SCHEDULING
+static bool TryReadNUMANodeCPUs(FileSystem &fs, const string &path, const cpu_set_t &available_cpus,
+                                vector<idx_t> &result) {
+	// the cpulist file contains a list of cpu ranges, e.g. "0-15,32-47"
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+	if (!handle) {
+		return false;
+	}
+	char buffer[4096];
+	auto bytes_read = fs.Read(*handle, buffer, sizeof(buffer) - 1);
+	buffer[bytes_read] = '\0';
+	for (auto &range : StringUtil::Split(StringUtil::Replace(buffer, "\n", ""), ",")) {
+		auto bounds = StringUtil::Split(range, "-");
+		if (bounds.empty() || bounds.size() > 2) {
+			return false;
+		}
+		idx_t start, end;
+		if (!TryCast::Operation<string_t, idx_t>(string_t(bounds[0]), start) ||
+		    !TryCast::Operation<string_t, idx_t>(string_t(bounds.back()), end)) {
+			return false;
+		}
+		for (idx_t cpu = start; cpu <= end && cpu < CPU_SETSIZE; cpu++) {
+			// only use the CPUs that this process is allowed to run on
+			if (CPU_ISSET(cpu, &available_cpus)) {
+				result.push_back(cpu);
+			}
+		}
+	}
+	return true;
+}
+#endif
+
+//! Returns the CPUs available to this process per NUMA node, or an empty list if there is only a single NUMA node
+static vector<vector<idx_t>> GetNUMANodeCPUs() {
+	vector<vector<idx_t>> result;
+#ifdef DUCKDB_NUMA_AWARE_SCHEDULING
+	cpu_set_t available_cpus;
+	CPU_ZERO(&available_cpus);
+	if (sched_getaffinity(0, sizeof(available_cpus), &available_cpus) != 0) {
+		return result;
+	}
+	try {
+		auto fs = FileSystem::CreateLocal();
+		const string node_directory = "/sys/devices/system/node";
+		if (!fs->DirectoryExists(node_directory)) {
+			return result;
+		}
+		vector<idx_t> nodes;
+		fs->ListFiles(node_directory, [&](const string &name, bool is_directory) {
+			idx_t node;
+			if (!is_directory || !StringUtil::StartsWith(name, "node") ||
+			    !TryCast::Operation<string_t, idx_t>(string_t(name.substr(4)), node, true)) {
+				return;
+			}
+			nodes.push_back(node);
+		});
+		std::sort(nodes.begin(), nodes.end());
+		for (auto &node : nodes) {
+			vector<idx_t> cpus;
+			auto path = fs->JoinPath(fs->JoinPath(node_directory, "node" + to_string(node)), "cpulist");
+			if (!TryReadNUMANodeCPUs(*fs, path, available_cpus, cpus)) {
+				return vector<vector<idx_t>>();
+			}
+			if (!cpus.empty()) {
+				result.push_back(std::move(cpus));
+			}
+		}
+	} catch (std::exception &ex) {
+		// failed to read the NUMA topology - schedule tasks as if there is a single node
+		return vector<vector<idx_t>>();
+	}
+	if (result.size() <= 1) {
+		result.clear();
+	}
+#endif
+	return result;
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
-    : db(db), queue(make_uniq<ConcurrentQueue>()),
+    : db(db), numa_node_cpus(GetNUMANodeCPUs()),
+      queue(make_uniq<ConcurrentQueue>(MaxValue<idx_t>(numa_node_cpus.size(), 1))),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
-      current_thread_count(1) {
+      current_thread_count(1), producer_count(0), active_producers(0), min_virtual_runtime(0) {
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
+	for (idx_t node = 0; node < numa_node_cpus.size(); node++) {
+		for (auto &cpu : numa_node_cpus[node]) {
+			if (cpu >= cpu_numa_node.size()) {
+				cpu_numa_node.resize(cpu + 1, 0);
+			}
+			cpu_numa_node[cpu] = node;
+		}
+	}
 }
 
 TaskScheduler::~TaskScheduler() {
@@ -145,23 +322,166 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 
 unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
 	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+	auto producer = make_uniq<ProducerToken>(*this, std::move(token));
+	lock_guard<mutex> guard(producers_lock);
+	producers.insert(*producer);
+	producer_count = producers.size();
+	return producer;
+}
+
+void TaskScheduler::RemoveProducer(ProducerToken &producer) {
+	lock_guard<mutex> guard(producers_lock);
+	producers.erase(producer);
+	producer_count = producers.size();
+}
+
+idx_t TaskScheduler::NumberOfNUMANodes() const {
+	return MaxValue<idx_t>(numa_node_cpus.size(), 1);
+}
+
+idx_t TaskScheduler::GetCurrentNUMANode() {
+	if (numa_node_cpus.empty()) {
+		return 0;
+	}
+#ifndef DUCKDB_NO_THREADS
+	if (current_scheduler_thread && current_scheduler_thread->numa_node < numa_node_cpus.size()) {
+		return current_scheduler_thread->numa_node;
+	}
+#endif
+	// an external thread - use the node of the CPU it is currently running on
+	auto cpu = GetEstimatedCPUId();
+	return cpu < cpu_numa_node.size() ? cpu_numa_node[cpu] : 0;
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
+	if (token.pending_tasks++ == 0) {
+		active_producers++;
+		// a producer that had no tasks waiting does not get to make up for the time it was idle
+		auto min_runtime = min_virtual_runtime.load();
+		if (token.virtual_runtime < min_runtime) {
+			token.virtual_runtime = min_runtime;
+		}
+	}
+	ScheduledTask entry;
+	entry.task = std::move(task);
+	entry.producer = &token;
+	entry.scheduled_time = std::chrono::steady_clock::now();
 	// Enqueue a task for the given producer token and signal any sleeping threads
-	queue->Enqueue(token, std::move(task));
+	// tasks are placed on the node of the scheduling thread, which typically produced the data the task consumes
+	queue->Enqueue(token, std::move(entry), GetCurrentNUMANode());
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	ScheduledTask entry;
+	if (!queue->DequeueFromProducer(token, entry, GetCurrentNUMANode())) {
+		return false;
+	}
+	TaskDequeued(entry);
+	task = std::move(entry.task);
+	return true;
+}
+
+void TaskScheduler::TaskDequeued(ScheduledTask &entry) {
+	if (!entry.producer) {
+		return;
+	}
+	auto &producer = *entry.producer;
+	auto wait_time = std::chrono::steady_clock::now() - entry.scheduled_time;
+	producer.scheduler_wait_time +=
+	    NumericCast<idx_t>(std::chrono::duration_cast<std::chrono::microseconds>(wait_time).count());
+	if (producer.pending_tasks-- == 1) {
+		active_producers--;
+	}
+}
+
+bool TaskScheduler::DequeueTask(ScheduledTask &entry, idx_t node, bool &stolen) {
+	stolen = false;
+	if (active_producers > 1) {
+		// tasks of multiple producers are waiting - pick the producer that has received the least CPU time
+		// relative to its priority
+		lock_guard<mutex> guard(producers_lock);
+		optional_ptr<ProducerToken> next_producer;
+		for (auto &producer_ref : producers) {
+			auto &producer = producer_ref.get();
+			if (producer.pending_tasks == 0) {
+				continue;
+			}
+			if (!next_producer || producer.virtual_runtime < next_producer->virtual_runtime) {
+				next_producer = &producer;
+			}
+		}
+		if (next_producer) {
+			auto runtime = next_producer->virtual_runtime.load();
+			if (runtime > min_virtual_runtime) {
+				min_virtual_runtime = runtime;
+			}
+			if (queue->DequeueFromProducer(*next_producer, entry, node)) {
+				TaskDequeued(entry);
+				return true;
+			}
+		}
+	}
+	if (!queue->Dequeue(entry, node, stolen)) {
+		return false;
+	}
+	TaskDequeued(entry);
+	return true;
+}
+
+bool TaskScheduler::ShouldPreempt(ProducerToken &producer) {
+	// other producers are waiting if there are active producers besides this one
+	auto other_producers = active_producers.load();
+	if (producer.pending_tasks > 0 && other_producers > 0) {
+		other_producers--;
+	}
+	return other_producers > 0;
+}
+
+bool TaskScheduler::ExecuteTask(ScheduledTask &entry) {
+	auto &task = entry.task;
+	// when multiple producers exist, tasks are executed in slices so they can be preempted in favor of other producers
+	auto mode = entry.producer && producer_count > 1 ? TaskExecutionMode::PROCESS_PARTIAL
+	                                                 : TaskExecutionMode::PROCESS_ALL;
+	while (true) {
+		auto start_time = std::chrono::steady_clock::now();
+		auto execute_result = task->Execute(mode);
+		if (entry.producer) {
+			auto runtime =
+			    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time);
+			entry.producer->virtual_runtime += NumericCast<idx_t>(runtime.count()) / entry.producer->priority;
+		}
+		switch (execute_result) {
+		case TaskExecutionResult::TASK_FINISHED:
+		case TaskExecutionResult::TASK_ERROR:
+			task.reset();
+			return true;
+		case TaskExecutionResult::TASK_NOT_FINISHED:
+			if (mode == TaskExecutionMode::PROCESS_ALL) {
+				throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
+			}
+			if (ShouldPreempt(*entry.producer)) {
+				// tasks of other producers are waiting - put this task back into the queue
+				ScheduleTask(*entry.producer, std::move(task));
+				return false;
+			}
+			break;
+		case TaskExecutionResult::TASK_BLOCKED:
+			task->Deschedule();
+			task.reset();
+			return false;
+		default:
+			throw InternalException("Unrecognized TaskExecutionResult");
+		}
+	}
 }
 
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 #ifndef DUCKDB_NO_THREADS
 	static constexpr const int64_t INITIAL_FLUSH_WAIT = 500000; // initial wait time of 0.5s (in mus) before flushing
 
-	shared_ptr<Task> task;
+	ScheduledTask task;
+	auto worker = current_scheduler_thread;
+	auto node = GetCurrentNUMANode();
 	// loop until the marker is set to false
 	while (*marker) {
 		if (!Allocator::SupportsFlush()) {
@@ -185,21 +505,17 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				}
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
-			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
-
-			switch (execute_result) {
-			case TaskExecutionResult::TASK_FINISHED:
-			case TaskExecutionResult::TASK_ERROR:
-				task.reset();
-				break;
-			case TaskExecutionResult::TASK_NOT_FINISHED:
-				throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
-			case TaskExecutionResult::TASK_BLOCKED:
-				task->Deschedule();
-				task.reset();
-				break;
+		bool stolen;
+		if (DequeueTask(task, node, stolen)) {
+			ExecuteTask(task);
+			if (worker) {
+				worker->tasks_executed++;
+				if (stolen) {
+					worker->tasks_stolen++;
+				}
 			}
+		} else if (worker) {
+			worker->idle_wakeups++;
 		}
 	}
 	// this thread will exit, flush all of its outstanding allocations
@@ -215,26 +531,16 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	idx_t completed_tasks = 0;
+	auto node = GetCurrentNUMANode();
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
-		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		ScheduledTask task;
+		bool stolen;
+		if (!DequeueTask(task, node, stolen)) {
 			return completed_tasks;
 		}
-		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
-
-		switch (execute_result) {
-		case TaskExecutionResult::TASK_FINISHED:
-		case TaskExecutionResult::TASK_ERROR:
-			task.reset();
+		if (ExecuteTask(task)) {
 			completed_tasks++;
-			break;
-		case TaskExecutionResult::TASK_NOT_FINISHED:
-			throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
-		case TaskExecutionResult::TASK_BLOCKED:
-			task->Deschedule();
-			task.reset();
-			break;
 		}
 	}
 	return completed_tasks;
@@ -245,26 +551,16 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 
 void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
-	shared_ptr<Task> task;
+	ScheduledTask task;
+	auto node = GetCurrentNUMANode();
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		bool stolen;
+		if (!DequeueTask(task, node, stolen)) {
 			return;
 		}
 		try {
-			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
-			switch (execute_result) {
-			case TaskExecutionResult::TASK_FINISHED:
-			case TaskExecutionResult::TASK_ERROR:
-				task.reset();
-				break;
-			case TaskExecutionResult::TASK_NOT_FINISHED:
-				throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
-			case TaskExecutionResult::TASK_BLOCKED:
-				task->Deschedule();
-				task.reset();
-				break;
-			}
+			ExecuteTask(task);
 		} catch (...) {
 			return;
 		}
@@ -275,8 +571,27 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
+static bool PinThreadToCPUs(const vector<idx_t> &cpus) {
+#ifdef DUCKDB_NUMA_AWARE_SCHEDULING
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto &cpu : cpus) {
+		CPU_SET(cpu, &cpu_set);
+	}
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+	return false;
+#endif
+}
+
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, SchedulerThread *scheduler_thread) {
+	if (!scheduler_thread->cpus.empty()) {
+		// keep the thread on the CPUs of its NUMA node so that the memory it allocates stays local
+		scheduler_thread->pinned = PinThreadToCPUs(scheduler_thread->cpus);
+	}
+	current_scheduler_thread = scheduler_thread;
 	scheduler->ExecuteForever(marker);
+	current_scheduler_thread = nullptr;
 }
 #endif
 
@@ -351,6 +666,24 @@ idx_t TaskScheduler::GetEstimatedCPUId() {
 #endif
 }
 
+vector<SchedulerThreadInformation> TaskScheduler::GetThreadInformation() {
+	vector<SchedulerThreadInformation> result;
+#ifndef DUCKDB_NO_THREADS
+	lock_guard<mutex> t(thread_lock);
+	for (auto &scheduler_thread : threads) {
+		SchedulerThreadInformation info;
+		info.thread_id = scheduler_thread->thread_id;
+		info.numa_node = scheduler_thread->numa_node;
+		info.pinned = scheduler_thread->pinned;
+		info.tasks_executed = scheduler_thread->tasks_executed;
+		info.tasks_stolen = scheduler_thread->tasks_stolen;
+		info.idle_wakeups = scheduler_thread->idle_wakeups;
+		result.push_back(info);
+	}
+#endif
+	return result;
+}
+
 void TaskScheduler::RelaunchThreads() {
 	lock_guard<mutex> t(thread_lock);
 	auto n = requested_thread_count.load();
@@ -385,15 +718,21 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
-			unique_ptr<thread> worker_thread;
+			// distribute the threads over the NUMA nodes in a round-robin fashion
+			auto thread_id = threads.size();
+			auto numa_node = numa_node_cpus.empty() ? 0 : thread_id % numa_node_cpus.size();
+			auto thread_wrapper = make_uniq<SchedulerThread>(thread_id, numa_node);
+			if (!numa_node_cpus.empty()) {
+				thread_wrapper->cpus = numa_node_cpus[numa_node];
+			}
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				thread_wrapper->internal_thread =
+				    make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), thread_wrapper.get());
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
 				break;
 			}
-			auto thread_wrapper = make_uniq<SchedulerThread>(std::move(worker_thread));
 
 			threads.push_back(std::move(thread_wrapper));
 			markers.push_back(std::move(marker));
@@ -0,0 +1,99 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+static idx_t GetBloomFilterBlockCount(idx_t key_count) {
+	return NextPowerOfTwo(MaxValue<idx_t>(key_count * BloomFilter::BITS_PER_KEY / 64, 1));
+}
+
+BloomFilter::BloomFilter(LogicalType key_type_p, idx_t key_count)
+    : TableFilter(TableFilterType::BLOOM_FILTER), key_type(std::move(key_type_p)),
+      blocks(GetBloomFilterBlockCount(key_count), 0) {
+}
+
+BloomFilter::BloomFilter(LogicalType key_type_p, vector<uint64_t> blocks_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), key_type(std::move(key_type_p)), blocks(std::move(blocks_p)) {
+	if (blocks.empty() || !IsPowerOfTwo(blocks.size())) {
+		throw InternalException("BloomFilter - block count must be a power of two");
+	}
+}
+
+void BloomFilter::Insert(Vector &keys, idx_t count) {
+	D_ASSERT(keys.GetType() == key_type);
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+
+	Vector hashes(LogicalType::HASH, count);
+	VectorOperations::Hash(keys, hashes, count);
+	hashes.Flatten(count);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	for (idx_t i = 0; i < count; i++) {
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+			continue;
+		}
+		auto hash = hash_data[i];
+		blocks[GetBlockIndex(hash)] |= GetMask(hash);
+	}
+}
+
+idx_t BloomFilter::Lookup(Vector &keys, UnifiedVectorFormat &vdata, const SelectionVector &sel, idx_t approved_count,
+                          SelectionVector &result_sel) const {
+	if (keys.GetType() != key_type) {
+		// hashes are only comparable for the same type - the filter can not remove anything
+		for (idx_t i = 0; i < approved_count; i++) {
+			result_sel.set_index(i, sel.get_index(i));
+		}
+		return approved_count;
+	}
+	// hash only the rows that are still selected - the hashes are written at the row index
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(keys, hashes, sel, approved_count);
+	hashes.Flatten(STANDARD_VECTOR_SIZE);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_count; i++) {
+		auto idx = sel.get_index(i);
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			continue;
+		}
+		if (Contains(hash_data[idx])) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	return result_count;
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	// the bloom filter only has hashes - it cannot be compared against min/max
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER(" + to_string(blocks.size() * 64) + " bits)";
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.key_type == key_type && other.blocks == blocks;
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(key_type, blocks);
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// the bloom filter is a superset of the original predicate, which is still evaluated elsewhere (e.g. in the join)
+	// it is therefore always correct to not filter anything
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+} // namespace duckdb
@@ -0,0 +1,226 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+InFilter::InFilter(vector<Value> values_p) : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)) {
+	if (values.empty()) {
+		throw InternalException("InFilter needs at least one value");
+	}
+	for (auto &value : values) {
+		if (value.IsNull()) {
+			throw InternalException("InFilter values cannot be NULL");
+		}
+		if (value.type() != values[0].type()) {
+			throw InternalException("InFilter values must all have the same type");
+		}
+	}
+	// sort the values so they can be binary searched (and compared against min/max), and remove duplicates
+	std::sort(values.begin(), values.end());
+	values.erase(std::unique(values.begin(), values.end()), values.end());
+}
+
+bool InFilter::SupportsType(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::INTERVAL:
+	case PhysicalType::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <class T>
+static bool InFilterContains(const T *begin, const T *end, const T &input) {
+	auto entry = std::lower_bound(begin, end, input,
+	                              [](const T &a, const T &b) { return LessThan::Operation<T>(a, b); });
+	return entry != end && Equals::Operation<T>(*entry, input);
+}
+
+template <class T>
+static idx_t TemplatedInFilterSelect(const vector<Value> &values, Vector &input, UnifiedVectorFormat &vdata,
+                                     const SelectionVector &sel, idx_t approved_count, SelectionVector &result_sel) {
+	auto constants = make_unsafe_uniq_array<T>(values.size());
+	for (idx_t i = 0; i < values.size(); i++) {
+		constants[i] = values[i].GetValueUnsafe<T>();
+	}
+	auto begin = constants.get();
+	auto end = constants.get() + values.size();
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+
+	idx_t result_count = 0;
+	if (input.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		// dictionary vector (e.g. from a dictionary compressed segment): look up every dictionary entry only once
+		idx_t dictionary_size = 0;
+		for (idx_t i = 0; i < approved_count; i++) {
+			dictionary_size = MaxValue<idx_t>(dictionary_size, vdata.sel->get_index(sel.get_index(i)) + 1);
+		}
+		if (dictionary_size < approved_count) {
+			static constexpr const uint8_t ENTRY_UNKNOWN = 0;
+			static constexpr const uint8_t ENTRY_FOUND = 1;
+			static constexpr const uint8_t ENTRY_NOT_FOUND = 2;
+			vector<uint8_t> entry_state(dictionary_size, ENTRY_UNKNOWN);
+			for (idx_t i = 0; i < approved_count; i++) {
+				auto idx = sel.get_index(i);
+				auto dictionary_idx = vdata.sel->get_index(idx);
+				auto &state = entry_state[dictionary_idx];
+				if (state == ENTRY_UNKNOWN) {
+					auto found = vdata.validity.RowIsValid(dictionary_idx) &&
+					             InFilterContains<T>(begin, end, data[dictionary_idx]);
+					state = found ? ENTRY_FOUND : ENTRY_NOT_FOUND;
+				}
+				if (state == ENTRY_FOUND) {
+					result_sel.set_index(result_count++, idx);
+				}
+			}
+			return result_count;
+		}
+	}
+	for (idx_t i = 0; i < approved_count; i++) {
+		auto idx = sel.get_index(i);
+		auto data_idx = vdata.sel->get_index(idx);
+		if (vdata.validity.RowIsValid(data_idx) && InFilterContains<T>(begin, end, data[data_idx])) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	return result_count;
+}
+
+idx_t InFilter::Select(Vector &input, UnifiedVectorFormat &vdata, const SelectionVector &sel, idx_t approved_count,
+                       SelectionVector &result_sel) const {
+	D_ASSERT(input.GetType().InternalType() == values[0].type().InternalType());
+	switch (input.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		return TemplatedInFilterSelect<bool>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::UINT8:
+		return TemplatedInFilterSelect<uint8_t>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::UINT16:
+		return TemplatedInFilterSelect<uint16_t>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::UINT32:
+		return TemplatedInFilterSelect<uint32_t>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::UINT64:
+		return TemplatedInFilterSelect<uint64_t>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::UINT128:
+		return TemplatedInFilterSelect<uhugeint_t>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::INT8:
+		return TemplatedInFilterSelect<int8_t>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::INT16:
+		return TemplatedInFilterSelect<int16_t>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::INT32:
+		return TemplatedInFilterSelect<int32_t>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::INT64:
+		return TemplatedInFilterSelect<int64_t>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::INT128:
+		return TemplatedInFilterSelect<hugeint_t>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::FLOAT:
+		return TemplatedInFilterSelect<float>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::DOUBLE:
+		return TemplatedInFilterSelect<double>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::INTERVAL:
+		return TemplatedInFilterSelect<interval_t>(values, input, vdata, sel, approved_count, result_sel);
+	case PhysicalType::VARCHAR:
+		return TemplatedInFilterSelect<string_t>(values, input, vdata, sel, approved_count, result_sel);
+	default:
+		throw InternalException("Unsupported type for InFilter");
+	}
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	D_ASSERT(values[0].type().id() == stats.GetType().id());
+	switch (values[0].type().InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		if (stats.GetStatsType() != StatisticsType::NUMERIC_STATS) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		break;
+	case PhysicalType::VARCHAR:
+		if (stats.GetStatsType() != StatisticsType::STRING_STATS) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		break;
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	// the filter can be pruned if every value is pruned, it is always true if any value covers the entire segment
+	FilterPropagateResult result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	for (auto &value : values) {
+		FilterPropagateResult value_result;
+		if (stats.GetStatsType() == StatisticsType::NUMERIC_STATS) {
+			value_result = NumericStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, value);
+		} else {
+			value_result = StringStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, StringValue::Get(value));
+		}
+		if (value_result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+			// NULL values never pass the filter
+			return stats.CanHaveNull() ? FilterPropagateResult::NO_PRUNING_POSSIBLE
+			                           : FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		}
+		if (value_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+	}
+	return result;
+}
+
+string InFilter::ToString(const string &column_name) {
+	string result = column_name + " IN (";
+	for (idx_t i = 0; i < values.size(); i++) {
+		if (i > 0) {
+			result += ", ";
+		}
+		result += values[i].ToSQLString();
+	}
+	return result + ")";
+}
+
+unique_ptr<Expression> InFilter::ToExpression(const Expression &column) const {
+	auto result = make_uniq<BoundOperatorExpression>(ExpressionType::COMPARE_IN, LogicalType::BOOLEAN);
+	result->children.push_back(column.Copy());
+	for (auto &value : values) {
+		result->children.push_back(make_uniq<BoundConstantExpression>(value));
+	}
+	return std::move(result);
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	return other.values == values;
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return make_uniq<InFilter>(values);
+}
+
+} // namespace duckdb
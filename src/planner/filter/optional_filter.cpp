@@ -0,0 +1,35 @@
+#include "duckdb/planner/filter/optional_filter.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+
+OptionalFilter::OptionalFilter(unique_ptr<TableFilter> child_filter_p)
+    : TableFilter(TableFilterType::OPTIONAL_FILTER), child_filter(std::move(child_filter_p)) {
+}
+
+FilterPropagateResult OptionalFilter::CheckStatistics(BaseStatistics &stats) {
+	// the child filter holds for all rows that pass the filtered expression, so we can prune with it
+	return child_filter->CheckStatistics(stats);
+}
+
+string OptionalFilter::ToString(const string &column_name) {
+	return "optional: " + child_filter->ToString(column_name);
+}
+
+bool OptionalFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<OptionalFilter>();
+	return other.child_filter->Equals(*child_filter);
+}
+
+unique_ptr<TableFilter> OptionalFilter::Copy() const {
+	return make_uniq<OptionalFilter>(child_filter->Copy());
+}
+
+unique_ptr<Expression> OptionalFilter::ToExpression(const Expression &column) const {
+	return child_filter->ToExpression(column);
+}
+
+} // namespace duckdb
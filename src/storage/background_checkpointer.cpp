@@ -0,0 +1,82 @@
+#include "duckdb/storage/background_checkpointer.hpp"
+
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/valid_checker.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
+
+namespace duckdb {
+
+BackgroundCheckpointer::BackgroundCheckpointer(DuckTransactionManager &transaction_manager)
+    : transaction_manager(transaction_manager) {
+}
+
+BackgroundCheckpointer::~BackgroundCheckpointer() {
+	Stop();
+}
+
+void BackgroundCheckpointer::RequestCheckpoint() {
+	{
+		lock_guard<mutex> guard(lock);
+		if (stopped) {
+			return;
+		}
+		checkpoint_requested = true;
+		if (!checkpoint_thread) {
+			checkpoint_thread = make_uniq<thread>([this]() { Run(); });
+		}
+	}
+	cv.notify_one();
+}
+
+void BackgroundCheckpointer::Stop() {
+	unique_ptr<thread> stopped_thread;
+	{
+		lock_guard<mutex> guard(lock);
+		stopped = true;
+		checkpoint_requested = false;
+		stopped_thread = std::move(checkpoint_thread);
+	}
+	cv.notify_one();
+	if (stopped_thread) {
+		stopped_thread->join();
+	}
+}
+
+void BackgroundCheckpointer::Run() {
+	unique_lock<mutex> guard(lock);
+	int64_t retry_interval_ms = INITIAL_RETRY_INTERVAL_MS;
+	while (true) {
+		cv.wait(guard, [&]() { return stopped || checkpoint_requested; });
+		if (stopped) {
+			return;
+		}
+		checkpoint_requested = false;
+		// release the lock while checkpointing so that commits can request the next checkpoint
+		guard.unlock();
+		bool finished = true;
+		try {
+			finished = transaction_manager.TryBackgroundCheckpoint();
+		} catch (std::exception &ex) {
+			// there is no connection to report a failed checkpoint to - invalidate the database directly
+			ErrorData error(ex);
+			if (error.Type() == ExceptionType::FATAL) {
+				ValidChecker::Invalidate(transaction_manager.GetDB().GetDatabase(), error.RawMessage());
+			}
+		} catch (...) { // NOLINT
+		}
+		guard.lock();
+		if (finished) {
+			retry_interval_ms = INITIAL_RETRY_INTERVAL_MS;
+		} else if (!stopped) {
+			// the checkpoint lock could not be obtained because a write transaction is active - retry later
+			// back off exponentially, so that a long-running write transaction does not keep this thread spinning
+			checkpoint_requested = true;
+			cv.wait_for(guard, std::chrono::milliseconds(retry_interval_ms), [&]() { return stopped; });
+			retry_interval_ms = MinValue<int64_t>(retry_interval_ms * 2, MAX_RETRY_INTERVAL_MS);
+		}
+	}
+}
+
+} // namespace duckdb
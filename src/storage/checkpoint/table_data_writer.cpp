@@ -22,6 +22,18 @@ void TableDataWriter::WriteTableData(Serializer &metadata_serializer) {
 	table.GetStorage().Checkpoint(*this, metadata_serializer);
 }
 
+void TableDataWriter::WriteRowGroupData() {
+	D_ASSERT(!global_stats);
+	global_stats = make_uniq<TableStatistics>();
+	table.GetStorage().WriteCheckpointData(*this, *global_stats);
+}
+
+void TableDataWriter::FinalizeTableData(Serializer &metadata_serializer) {
+	D_ASSERT(global_stats);
+	table.GetStorage().FinalizeCheckpoint(*this, *global_stats, metadata_serializer);
+	global_stats.reset();
+}
+
 CompressionType TableDataWriter::GetColumnCompressionType(idx_t i) {
 	return table.GetColumn(LogicalIndex(i)).CompressionType();
 }
@@ -40,12 +52,19 @@ DatabaseInstance &TableDataWriter::GetDatabase() {
 
 SingleFileTableDataWriter::SingleFileTableDataWriter(SingleFileCheckpointWriter &checkpoint_manager,
                                                      TableCatalogEntry &table, MetadataWriter &table_data_writer)
-    : TableDataWriter(table), checkpoint_manager(checkpoint_manager), table_data_writer(table_data_writer) {
+    : SingleFileTableDataWriter(checkpoint_manager, table, table_data_writer,
+                                checkpoint_manager.partial_block_manager) {
+}
+
+SingleFileTableDataWriter::SingleFileTableDataWriter(SingleFileCheckpointWriter &checkpoint_manager,
+                                                     TableCatalogEntry &table, MetadataWriter &table_data_writer,
+                                                     PartialBlockManager &partial_block_manager)
+    : TableDataWriter(table), checkpoint_manager(checkpoint_manager), table_data_writer(table_data_writer),
+      partial_block_manager(partial_block_manager) {
 }
 
 unique_ptr<RowGroupWriter> SingleFileTableDataWriter::GetRowGroupWriter(RowGroup &row_group) {
-	return make_uniq<SingleFileRowGroupWriter>(table, checkpoint_manager.partial_block_manager, *this,
-	                                           table_data_writer);
+	return make_uniq<SingleFileRowGroupWriter>(table, partial_block_manager, *this, table_data_writer);
 }
 
 CheckpointType SingleFileTableDataWriter::GetCheckpointType() const {
@@ -67,6 +86,8 @@ void SingleFileTableDataWriter::FinalizeTable(const TableStatistics &global_stat
 
 	// now start writing the row group pointers to disk
 	table_data_writer.Write<uint64_t>(row_group_pointers.size());
+	checkpoint_manager.statistics.table_count++;
+	checkpoint_manager.statistics.row_group_count += row_group_pointers.size();
 	idx_t total_rows = 0;
 	for (auto &row_group_pointer : row_group_pointers) {
 		auto row_group_count = row_group_pointer.row_start + row_group_pointer.tuple_count;
@@ -10,6 +10,7 @@
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
 #include "duckdb/catalog/duck_catalog.hpp"
 #include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/unbound_index.hpp"
@@ -18,6 +19,8 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
 #include "duckdb/planner/binder.hpp"
@@ -27,6 +30,7 @@
 #include "duckdb/storage/checkpoint/table_data_reader.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
+#include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
@@ -41,6 +45,9 @@ SingleFileCheckpointWriter::SingleFileCheckpointWriter(AttachedDatabase &db, Blo
       checkpoint_type(checkpoint_type) {
 }
 
+SingleFileCheckpointWriter::~SingleFileCheckpointWriter() {
+}
+
 BlockManager &SingleFileCheckpointWriter::GetBlockManager() {
 	auto &storage_manager = db.GetStorageManager().Cast<SingleFileStorageManager>();
 	return *storage_manager.block_manager;
@@ -126,6 +133,52 @@ static catalog_entry_vector_t GetCatalogEntries(vector<reference<SchemaCatalogEn
 	return entries;
 }
 
+//! Writes the row group data of a single table
+class WriteTableDataTask : public BaseExecutorTask {
+public:
+	WriteTableDataTask(TaskExecutor &executor, TableDataWriter &writer, PartialBlockManager &partial_block_manager)
+	    : BaseExecutorTask(executor), writer(writer), partial_block_manager(partial_block_manager) {
+	}
+
+	void ExecuteTask() override {
+		writer.WriteRowGroupData();
+		// flush any partial blocks BEFORE releasing the table lock
+		partial_block_manager.FlushPartialBlocks();
+	}
+
+private:
+	TableDataWriter &writer;
+	PartialBlockManager &partial_block_manager;
+};
+
+void SingleFileCheckpointWriter::WriteTableData(const catalog_entry_vector_t &catalog_entries) {
+	// every table gets its own partial block manager, so that the tables can be written independently
+	// partial blocks were already flushed after every table, so this does not change how densely blocks are packed
+	auto &block_manager = GetBlockManager();
+	TaskExecutor executor(TaskScheduler::GetScheduler(db.GetDatabase()));
+	for (auto &entry_ref : catalog_entries) {
+		auto &entry = entry_ref.get();
+		if (entry.type != CatalogType::TABLE_ENTRY) {
+			continue;
+		}
+		auto &table = entry.Cast<TableCatalogEntry>();
+		if (!table.IsDuckTable()) {
+			continue;
+		}
+		// the checkpoint locks are acquired in catalog order
+		PendingTableData pending;
+		pending.checkpoint_lock = table.GetStorage().GetCheckpointLock();
+		pending.partial_block_manager =
+		    make_uniq<PartialBlockManager>(block_manager, PartialBlockType::FULL_CHECKPOINT);
+		pending.writer = make_uniq<SingleFileTableDataWriter>(*this, table, *table_metadata_writer,
+		                                                      *pending.partial_block_manager);
+		executor.ScheduleTask(
+		    make_uniq<WriteTableDataTask>(executor, *pending.writer, *pending.partial_block_manager));
+		pending_tables.emplace(table, std::move(pending));
+	}
+	executor.WorkOnTasks();
+}
+
 void SingleFileCheckpointWriter::CreateCheckpoint() {
 	auto &config = DBConfig::Get(db);
 	auto &storage_manager = db.GetStorageManager().Cast<SingleFileStorageManager>();
@@ -135,6 +188,10 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	// assert that the checkpoint manager hasn't been used before
 	D_ASSERT(!metadata_writer);
 
+	Profiler total_profiler;
+	Profiler profiler;
+	total_profiler.Start();
+
 	auto &block_manager = GetBlockManager();
 	auto &metadata_manager = GetMetadataManager();
 
@@ -170,6 +227,16 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	    }
 	 */
 	auto catalog_entries = GetCatalogEntries(schemas);
+
+	// first write the row group data of all tables in parallel
+	profiler.Start();
+	WriteTableData(catalog_entries);
+	profiler.End();
+	statistics.write_data_seconds = profiler.Elapsed();
+
+	// now write the catalog entries and the table metadata - this happens in catalog order so the metadata layout is
+	// deterministic
+	profiler.Start();
 	SerializationOptions serialization_options;
 
 	serialization_options.serialization_compatibility = config.options.serialization_compatibility;
@@ -184,6 +251,10 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 
 	metadata_writer->Flush();
 	table_metadata_writer->Flush();
+	D_ASSERT(pending_tables.empty());
+	profiler.End();
+	statistics.write_metadata_seconds = profiler.Elapsed();
+	profiler.Start();
 
 	// write a checkpoint flag to the WAL
 	// this protects against the rare event that the database crashes AFTER writing the file, but BEFORE truncating the
@@ -247,6 +318,10 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	if (!wal_is_empty) {
 		storage_manager.ResetWAL();
 	}
+	profiler.End();
+	total_profiler.End();
+	statistics.finalize_seconds = profiler.Elapsed();
+	statistics.total_seconds = total_profiler.Elapsed();
 }
 
 void CheckpointReader::LoadCheckpoint(CatalogTransaction transaction, MetadataReader &reader) {
@@ -523,6 +598,14 @@ void SingleFileCheckpointWriter::WriteTable(TableCatalogEntry &table, Serializer
 	serializer.WriteProperty(100, "table", &table);
 
 	// Write the table data
+	auto pending_entry = pending_tables.find(table);
+	if (pending_entry != pending_tables.end()) {
+		// the row group data was written by WriteTableData - only the metadata remains
+		pending_entry->second.writer->FinalizeTableData(serializer);
+		// erasing the entry releases the checkpoint lock of the table
+		pending_tables.erase(pending_entry);
+		return;
+	}
 	auto table_lock = table.GetStorage().GetCheckpointLock();
 	if (auto writer = GetTableDataWriter(table)) {
 		writer->WriteTableData(serializer);
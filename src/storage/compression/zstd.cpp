@@ -0,0 +1,475 @@
+#include "duckdb/common/constants.hpp"
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+
+#include "zstd.h"
+
+namespace duckdb {
+
+// A ZSTD segment is made up of independently compressed frames of at most STANDARD_VECTOR_SIZE rows.
+// Every frame holds the lengths of its strings, followed by the string data:
+// | header | frame directory | frame 0 | frame 1 | ... |
+// The frame directory stores the first row and the location of every frame, so that scans and fetches only
+// decompress the frames that contain the rows they need.
+typedef struct {
+	uint32_t frame_count;
+} zstd_compression_header_t;
+
+typedef struct {
+	uint32_t row_start;
+	uint32_t compressed_offset;
+	uint32_t compressed_size;
+	uint32_t uncompressed_size;
+} zstd_frame_entry_t;
+
+struct ZSTDStorage {
+	static constexpr int COMPRESSION_LEVEL = 3;
+	//! ZSTD needs to decompress a frame before reading any of its strings, so we only pick it over the other
+	//! methods when it is clearly better
+	static constexpr double MINIMUM_COMPRESSION_RATIO = 2.0;
+	static constexpr double ANALYSIS_SAMPLE_SIZE = 0.25;
+	//! Unless forced, ZSTD is not considered for columns of short strings, which are better served by dictionary
+	//! compression and FSST
+	static constexpr idx_t MINIMUM_AVERAGE_STRING_LENGTH = 32;
+
+	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
+	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
+	static idx_t StringFinalAnalyze(AnalyzeState &state_p);
+
+	static unique_ptr<CompressionState> InitCompression(ColumnDataCheckpointer &checkpointer,
+	                                                    unique_ptr<AnalyzeState> analyze_state_p);
+	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
+	static void FinalizeCompress(CompressionState &state_p);
+
+	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
+	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                              idx_t result_offset);
+	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+	                           idx_t result_idx);
+
+	//! The maximum uncompressed size of a frame, frames with a single string may exceed it up to the string limit
+	static idx_t GetMaximumFrameSize(idx_t block_size);
+	static idx_t CompressFrame(const vector<data_t> &frame, vector<data_t> &compressed);
+};
+
+idx_t ZSTDStorage::GetMaximumFrameSize(idx_t block_size) {
+	return block_size / 4;
+}
+
+idx_t ZSTDStorage::CompressFrame(const vector<data_t> &frame, vector<data_t> &compressed) {
+	compressed.resize(duckdb_zstd::ZSTD_compressBound(frame.size()));
+	auto compressed_size = duckdb_zstd::ZSTD_compress(compressed.data(), compressed.size(), frame.data(),
+	                                                  frame.size(), COMPRESSION_LEVEL);
+	if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+		throw InternalException("ZSTD compression failed: %s", duckdb_zstd::ZSTD_getErrorName(compressed_size));
+	}
+	return compressed_size;
+}
+
+//! Appends a string to an uncompressed frame: the lengths are stored in front of the string data
+static void AppendToFrame(vector<uint32_t> &lengths, vector<data_t> &data, const string_t &str) {
+	auto size = str.GetSize();
+	lengths.push_back(NumericCast<uint32_t>(size));
+	auto str_data = const_data_ptr_cast(str.GetData());
+	data.insert(data.end(), str_data, str_data + size);
+}
+
+static void SerializeFrame(const vector<uint32_t> &lengths, const vector<data_t> &data, vector<data_t> &frame) {
+	auto lengths_size = lengths.size() * sizeof(uint32_t);
+	frame.resize(lengths_size + data.size());
+	if (!lengths.empty()) {
+		memcpy(frame.data(), lengths.data(), lengths_size);
+	}
+	if (!data.empty()) {
+		memcpy(frame.data() + lengths_size, data.data(), data.size());
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	explicit ZSTDAnalyzeState(const CompressionInfo &info) : AnalyzeState(info) {
+	}
+
+	bool forced = false;
+	idx_t count = 0;
+	idx_t valid_count = 0;
+	idx_t total_string_size = 0;
+	//! The uncompressed and compressed sizes of the sampled frames
+	idx_t sampled_size = 0;
+	idx_t sampled_compressed_size = 0;
+
+	vector<uint32_t> frame_lengths;
+	vector<data_t> frame_data;
+	vector<data_t> frame;
+	vector<data_t> compressed_frame;
+
+	RandomEngine random_engine;
+};
+
+unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
+	auto state = make_uniq<ZSTDAnalyzeState>(info);
+	auto &config = DBConfig::GetConfig(col_data.GetDatabase());
+	state->forced = config.options.force_compression == CompressionType::COMPRESSION_ZSTD;
+	return std::move(state);
+}
+
+bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	// the first vector is always sampled, so that we have an estimate of the compression ratio
+	bool sample_selected = state.sampled_size == 0 || state.random_engine.NextRandom() < ANALYSIS_SAMPLE_SIZE;
+	auto string_block_limit = StringUncompressed::GetStringBlockLimit(state.info.GetBlockSize());
+
+	state.count += count;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		string_t str(nullptr, 0);
+		if (vdata.validity.RowIsValid(idx)) {
+			str = data[idx];
+			// strings have to fit into a single frame
+			if (str.GetSize() >= string_block_limit) {
+				return false;
+			}
+			state.valid_count++;
+			state.total_string_size += str.GetSize();
+		}
+		if (sample_selected) {
+			AppendToFrame(state.frame_lengths, state.frame_data, str);
+		}
+	}
+	if (!sample_selected) {
+		return true;
+	}
+	SerializeFrame(state.frame_lengths, state.frame_data, state.frame);
+	state.sampled_size += state.frame.size();
+	state.sampled_compressed_size += CompressFrame(state.frame, state.compressed_frame);
+	state.frame_lengths.clear();
+	state.frame_data.clear();
+	return true;
+}
+
+idx_t ZSTDStorage::StringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	if (state.valid_count == 0 || state.sampled_size == 0) {
+		return DConstants::INVALID_INDEX;
+	}
+	if (!state.forced && state.total_string_size / state.valid_count < MINIMUM_AVERAGE_STRING_LENGTH) {
+		return DConstants::INVALID_INDEX;
+	}
+	auto compression_ratio = double(state.sampled_compressed_size) / double(state.sampled_size);
+	auto uncompressed_size = double(state.count * sizeof(uint32_t) + state.total_string_size);
+	auto frame_count = double(state.count) / double(STANDARD_VECTOR_SIZE) + 1;
+	auto estimated_size = uncompressed_size * compression_ratio + frame_count * sizeof(zstd_frame_entry_t);
+	return LossyNumericCast<idx_t>(estimated_size * MINIMUM_COMPRESSION_RATIO);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+class ZSTDCompressionState : public CompressionState {
+public:
+	ZSTDCompressionState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)),
+	      frame_statistics(StringStats::CreateEmpty(checkpointer.GetType())),
+	      maximum_frame_size(ZSTDStorage::GetMaximumFrameSize(info.GetBlockSize())) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+
+		auto compressed_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		current_segment = std::move(compressed_segment);
+		current_segment->function = function;
+		frame_entries.clear();
+		segment_data.clear();
+	}
+
+	void Append(const string_t &str, bool is_valid) {
+		auto frame_size = frame_lengths.size() * sizeof(uint32_t) + frame_data.size();
+		auto required_size = frame_size + sizeof(uint32_t) + str.GetSize();
+		if (!frame_lengths.empty() && required_size > maximum_frame_size) {
+			FinishFrame();
+		}
+		AppendToFrame(frame_lengths, frame_data, str);
+		if (is_valid) {
+			StringStats::Update(frame_statistics, str);
+		}
+		if (frame_lengths.size() == STANDARD_VECTOR_SIZE) {
+			FinishFrame();
+		}
+	}
+
+	idx_t GetSegmentSize(idx_t frame_count, idx_t data_size) {
+		return sizeof(zstd_compression_header_t) + frame_count * sizeof(zstd_frame_entry_t) + data_size;
+	}
+
+	void FinishFrame() {
+		if (frame_lengths.empty()) {
+			return;
+		}
+		SerializeFrame(frame_lengths, frame_data, frame);
+		auto compressed_size = ZSTDStorage::CompressFrame(frame, compressed_frame);
+		if (GetSegmentSize(1, compressed_size) > info.GetBlockSize()) {
+			throw InternalException("ZSTD string compression failed due to insufficient space in empty block");
+		}
+		if (GetSegmentSize(frame_entries.size() + 1, segment_data.size() + compressed_size) > info.GetBlockSize()) {
+			Flush();
+		}
+
+		zstd_frame_entry_t entry;
+		entry.row_start = NumericCast<uint32_t>(current_segment->count.load());
+		entry.compressed_offset = NumericCast<uint32_t>(segment_data.size());
+		entry.compressed_size = NumericCast<uint32_t>(compressed_size);
+		entry.uncompressed_size = NumericCast<uint32_t>(frame.size());
+		frame_entries.push_back(entry);
+		segment_data.insert(segment_data.end(), compressed_frame.data(), compressed_frame.data() + compressed_size);
+
+		current_segment->count += frame_lengths.size();
+		StringStats::Merge(current_segment->stats.statistics, frame_statistics);
+
+		frame_lengths.clear();
+		frame_data.clear();
+		frame_statistics = StringStats::CreateEmpty(checkpointer.GetType());
+	}
+
+	void Flush(bool final = false) {
+		auto next_start = current_segment->start + current_segment->count;
+
+		auto segment_size = Finalize();
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), segment_size);
+
+		if (!final) {
+			CreateEmptySegment(next_start);
+		}
+	}
+
+	idx_t Finalize() {
+		auto &buffer_manager = BufferManager::GetBufferManager(current_segment->db);
+		auto handle = buffer_manager.Pin(current_segment->block);
+		auto base_ptr = handle.Ptr();
+
+		// write the header and the frame directory, followed by the compressed frames
+		auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+		Store<uint32_t>(NumericCast<uint32_t>(frame_entries.size()), data_ptr_cast(&header_ptr->frame_count));
+		auto directory_offset = sizeof(zstd_compression_header_t);
+		auto data_offset = directory_offset + frame_entries.size() * sizeof(zstd_frame_entry_t);
+		for (idx_t i = 0; i < frame_entries.size(); i++) {
+			auto entry = frame_entries[i];
+			entry.compressed_offset += NumericCast<uint32_t>(data_offset);
+			memcpy(base_ptr + directory_offset + i * sizeof(zstd_frame_entry_t), &entry, sizeof(zstd_frame_entry_t));
+		}
+		if (!segment_data.empty()) {
+			memcpy(base_ptr + data_offset, segment_data.data(), segment_data.size());
+		}
+
+		auto total_size = data_offset + segment_data.size();
+		D_ASSERT(total_size == GetSegmentSize(frame_entries.size(), segment_data.size()));
+		if (total_size >= info.GetCompactionFlushLimit()) {
+			// the block is full enough, don't bother compacting it
+			return info.GetBlockSize();
+		}
+		return total_size;
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+
+	// State regarding current segment
+	unique_ptr<ColumnSegment> current_segment;
+	vector<zstd_frame_entry_t> frame_entries;
+	vector<data_t> segment_data;
+
+	// The frame that is currently being filled
+	vector<uint32_t> frame_lengths;
+	vector<data_t> frame_data;
+	BaseStatistics frame_statistics;
+	idx_t maximum_frame_size;
+
+	// Buffers reused across frames
+	vector<data_t> frame;
+	vector<data_t> compressed_frame;
+};
+
+unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointer &checkpointer,
+                                                          unique_ptr<AnalyzeState> analyze_state_p) {
+	return make_uniq<ZSTDCompressionState>(checkpointer, analyze_state_p->info);
+}
+
+void ZSTDStorage::Compress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		// NULLs are stored as empty strings, the validity is kept in the validity segments
+		if (!vdata.validity.RowIsValid(idx)) {
+			state.Append(string_t(nullptr, 0), false);
+		} else {
+			state.Append(data[idx], true);
+		}
+	}
+}
+
+void ZSTDStorage::FinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	state.FinishFrame();
+	state.Flush(true);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDFrameReader {
+	//! Index of the decompressed frame, or INVALID_INDEX if there is none yet
+	idx_t frame_idx = DConstants::INVALID_INDEX;
+	idx_t frame_start = 0;
+	idx_t frame_end = 0;
+	vector<data_t> buffer;
+	//! The offset of every string in the decompressed frame
+	vector<uint32_t> string_offsets;
+
+	static zstd_frame_entry_t GetFrame(data_ptr_t base_ptr, idx_t frame_idx) {
+		zstd_frame_entry_t entry;
+		auto directory = base_ptr + sizeof(zstd_compression_header_t);
+		memcpy(&entry, directory + frame_idx * sizeof(zstd_frame_entry_t), sizeof(zstd_frame_entry_t));
+		return entry;
+	}
+
+	//! Decompresses the frame that holds the given row of the segment, unless it is already loaded
+	void LoadFrame(ColumnSegment &segment, data_ptr_t base_ptr, idx_t row) {
+		if (frame_idx != DConstants::INVALID_INDEX && row >= frame_start && row < frame_end) {
+			return;
+		}
+		auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+		idx_t frame_count = Load<uint32_t>(data_ptr_cast(&header_ptr->frame_count));
+		D_ASSERT(frame_count > 0);
+
+		// binary search for the last frame that starts at or before the row
+		idx_t lower = 0;
+		idx_t upper = frame_count;
+		while (upper - lower > 1) {
+			auto middle = lower + (upper - lower) / 2;
+			if (GetFrame(base_ptr, middle).row_start <= row) {
+				lower = middle;
+			} else {
+				upper = middle;
+			}
+		}
+		auto entry = GetFrame(base_ptr, lower);
+		frame_idx = lower;
+		frame_start = entry.row_start;
+		frame_end = lower + 1 < frame_count ? GetFrame(base_ptr, lower + 1).row_start : segment.count.load();
+		D_ASSERT(row >= frame_start && row < frame_end);
+
+		buffer.resize(entry.uncompressed_size);
+		auto compressed_ptr = base_ptr + entry.compressed_offset;
+		auto decompressed_size =
+		    duckdb_zstd::ZSTD_decompress(buffer.data(), buffer.size(), compressed_ptr, entry.compressed_size);
+		if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != entry.uncompressed_size) {
+			frame_idx = DConstants::INVALID_INDEX;
+			throw IOException("Failed to decompress frame %llu of ZSTD segment", lower);
+		}
+
+		auto string_count = frame_end - frame_start;
+		string_offsets.resize(string_count + 1);
+		uint32_t offset = NumericCast<uint32_t>(string_count * sizeof(uint32_t));
+		for (idx_t i = 0; i < string_count; i++) {
+			string_offsets[i] = offset;
+			offset += Load<uint32_t>(buffer.data() + i * sizeof(uint32_t));
+		}
+		string_offsets[string_count] = offset;
+		D_ASSERT(offset == buffer.size());
+	}
+
+	string_t GetString(Vector &result, idx_t row) {
+		D_ASSERT(row >= frame_start && row < frame_end);
+		auto string_idx = row - frame_start;
+		auto offset = string_offsets[string_idx];
+		auto length = string_offsets[string_idx + 1] - offset;
+		if (length == 0) {
+			return string_t(nullptr, 0);
+		}
+		return StringVector::AddStringOrBlob(result, const_char_ptr_cast(buffer.data() + offset), length);
+	}
+};
+
+struct ZSTDScanState : public StringScanState {
+	ZSTDFrameReader reader;
+};
+
+unique_ptr<SegmentScanState> ZSTDStorage::StringInitScan(ColumnSegment &segment) {
+	auto state = make_uniq<ZSTDScanState>();
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	state->handle = buffer_manager.Pin(segment.block);
+	return std::move(state);
+}
+
+void ZSTDStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                    idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto base_ptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+
+	D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	for (idx_t i = 0; i < scan_count; i++) {
+		scan_state.reader.LoadFrame(segment, base_ptr, start + i);
+		result_data[result_offset + i] = scan_state.reader.GetString(result, start + i);
+	}
+}
+
+void ZSTDStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	StringScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	auto handle = buffer_manager.Pin(segment.block);
+	auto base_ptr = handle.Ptr() + segment.GetBlockOffset();
+
+	// only the frame that holds the row is decompressed
+	ZSTDFrameReader reader;
+	auto row = UnsafeNumericCast<idx_t>(row_id);
+	reader.LoadFrame(segment, base_ptr, row);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result_data[result_idx] = reader.GetString(result, row);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	return CompressionFunction(
+	    CompressionType::COMPRESSION_ZSTD, data_type, ZSTDStorage::StringInitAnalyze, ZSTDStorage::StringAnalyze,
+	    ZSTDStorage::StringFinalAnalyze, ZSTDStorage::InitCompression, ZSTDStorage::Compress,
+	    ZSTDStorage::FinalizeCompress, ZSTDStorage::StringInitScan, ZSTDStorage::StringScan,
+	    ZSTDStorage::StringScanPartial, ZSTDStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+}
+
+bool ZSTDFun::TypeIsSupported(const PhysicalType physical_type) {
+	return physical_type == PhysicalType::VARCHAR;
+}
+
+} // namespace duckdb
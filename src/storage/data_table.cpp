@@ -32,7 +32,8 @@ namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)) {
+    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)),
+      last_commit_id(0) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context, const char *index_type) {
@@ -386,6 +387,12 @@ void DataTable::Fetch(DuckTransaction &transaction, DataChunk &result, const vec
 	row_groups->Fetch(transaction, result, column_ids, row_identifiers, fetch_count, state);
 }
 
+idx_t DataTable::SelectVisibleRows(DuckTransaction &transaction, const Vector &row_ids, idx_t count,
+                                   SelectionVector &sel) {
+	auto lock = info->checkpoint_lock.GetSharedLock();
+	return row_groups->SelectVisibleRows(transaction, row_ids, count, sel);
+}
+
 //===--------------------------------------------------------------------===//
 // Append
 //===--------------------------------------------------------------------===//
@@ -1421,10 +1428,19 @@ unique_ptr<StorageLockKey> DataTable::GetCheckpointLock() {
 }
 
 void DataTable::Checkpoint(TableDataWriter &writer, Serializer &serializer) {
-	// checkpoint each individual row group
 	TableStatistics global_stats;
+	WriteCheckpointData(writer, global_stats);
+	FinalizeCheckpoint(writer, global_stats, serializer);
+}
+
+void DataTable::WriteCheckpointData(TableDataWriter &writer, TableStatistics &global_stats) {
+	// checkpoint each individual row group
 	row_groups->CopyStats(global_stats);
-	row_groups->Checkpoint(writer, global_stats);
+	row_groups->WriteCheckpointData(writer, global_stats);
+}
+
+void DataTable::FinalizeCheckpoint(TableDataWriter &writer, TableStatistics &global_stats, Serializer &serializer) {
+	row_groups->FinalizeCheckpoint();
 
 	// The row group payload data has been written. Now write:
 	//   column stats
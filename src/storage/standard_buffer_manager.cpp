@@ -336,6 +336,11 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 			// now we can actually load the current block
 			D_ASSERT(handle->readers == 0);
 			buf = handle->Load(std::move(reusable_buffer));
+			if (!buf.IsValid()) {
+				// the buffer was destroyed when it was evicted - there is nothing to load
+				reservation.Resize(0);
+				return buf;
+			}
 			handle->readers = 1;
 			handle->memory_charge = std::move(reservation);
 			// in the case of a variable sized block, the buffer may be smaller than a full block.
@@ -568,6 +573,7 @@ vector<TemporaryFileInformation> StandardBufferManager::GetTemporaryFiles() {
 		TemporaryFileInformation info;
 		info.path = name;
 		info.size = NumericCast<idx_t>(fs.GetFileSize(*handle));
+		info.uncompressed_size = info.size;
 		handle.reset();
 		result.push_back(info);
 	});
@@ -20,7 +20,7 @@
 namespace duckdb {
 
 StorageManager::StorageManager(AttachedDatabase &db, string path_p, bool read_only)
-    : db(db), path(std::move(path_p)), read_only(read_only) {
+    : db(db), path(std::move(path_p)), read_only(read_only), attach_time(high_resolution_clock::now()) {
 
 	if (path.empty()) {
 		path = IN_MEMORY_PATH;
@@ -33,6 +33,32 @@ StorageManager::StorageManager(AttachedDatabase &db, string path_p, bool read_on
 StorageManager::~StorageManager() {
 }
 
+void StorageManager::RegisterWALCommit() {
+	lock_guard<mutex> guard(wal_statistics_lock);
+	wal_statistics.commit_count++;
+}
+
+void StorageManager::RegisterWALSync(idx_t commit_count, double seconds) {
+	lock_guard<mutex> guard(wal_statistics_lock);
+	wal_statistics.sync_count++;
+	wal_statistics.synced_commit_count += commit_count;
+	wal_statistics.max_batch_size = MaxValue(wal_statistics.max_batch_size, commit_count);
+	wal_statistics.sync_seconds += seconds;
+}
+
+void StorageManager::RegisterWALReplay(idx_t bytes, double seconds) {
+	lock_guard<mutex> guard(wal_statistics_lock);
+	wal_statistics.replayed_bytes += bytes;
+	wal_statistics.replay_seconds += seconds;
+}
+
+WALStatistics StorageManager::GetWALStatistics() {
+	lock_guard<mutex> guard(wal_statistics_lock);
+	auto result = wal_statistics;
+	result.elapsed_seconds = duration<double>(high_resolution_clock::now() - attach_time).count();
+	return result;
+}
+
 StorageManager &StorageManager::Get(AttachedDatabase &db) {
 	return db.GetStorageManager();
 }
@@ -251,6 +277,7 @@ public:
 	void RevertCommit() override;
 	// Make the commit persistent
 	void FlushCommit() override;
+	void SyncCommit() override;
 
 	void AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
 	                     unique_ptr<PersistentCollectionData> row_group_data) override;
@@ -262,6 +289,8 @@ private:
 	idx_t initial_written = 0;
 	WriteAheadLog &wal;
 	WALCommitState state;
+	//! The position in the WAL up to which the commit was written by FlushCommit
+	idx_t commit_position = 0;
 	reference_map_t<DataTable, unordered_map<idx_t, OptimisticallyWrittenRowGroupData>> optimistically_written_data;
 };
 
@@ -298,10 +327,18 @@ void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	// write the commit to the WAL - it is synced to disk in SyncCommit, after the transaction locks are released
+	commit_position = wal.WriteCommit();
 	state = WALCommitState::FLUSHED;
 }
 
+void SingleFileStorageCommitState::SyncCommit() {
+	if (state != WALCommitState::FLUSHED) {
+		return;
+	}
+	wal.SyncCommit(commit_position);
+}
+
 void SingleFileStorageCommitState::AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
                                                    unique_ptr<PersistentCollectionData> row_group_data) {
 	if (row_group_data->HasUpdates()) {
@@ -363,6 +400,9 @@ void SingleFileStorageManager::CreateCheckpoint(CheckpointOptions options) {
 		try {
 			SingleFileCheckpointWriter checkpointer(db, *block_manager, options.type);
 			checkpointer.CreateCheckpoint();
+
+			lock_guard<mutex> guard(checkpoint_statistics_lock);
+			last_checkpoint = make_uniq<CheckpointStatistics>(checkpointer.GetStatistics());
 		} catch (std::exception &ex) {
 			ErrorData error(ex);
 			throw FatalException("Failed to create checkpoint because of error: %s", error.RawMessage());
@@ -391,6 +431,15 @@ DatabaseSize SingleFileStorageManager::GetDatabaseSize() {
 	return ds;
 }
 
+bool SingleFileStorageManager::GetLastCheckpoint(CheckpointStatistics &result) {
+	lock_guard<mutex> guard(checkpoint_statistics_lock);
+	if (!last_checkpoint) {
+		return false;
+	}
+	result = *last_checkpoint;
+	return true;
+}
+
 vector<MetadataBlockInfo> SingleFileStorageManager::GetMetadataInfo() {
 	auto &metadata_manager = block_manager->GetMetadataManager();
 	return metadata_manager.GetMetadataInfo();
@@ -4,8 +4,11 @@
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -530,6 +533,25 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return FilterSelection(sel, *child_vec, child_data, *struct_filter.child_filter, scan_count,
 		                       approved_tuple_count);
 	}
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		SelectionVector result_sel(approved_tuple_count);
+		approved_tuple_count = bloom_filter.Lookup(vector, vdata, sel, approved_tuple_count, result_sel);
+		sel.Initialize(result_sel);
+		return approved_tuple_count;
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		SelectionVector result_sel(approved_tuple_count);
+		approved_tuple_count = in_filter.Select(vector, vdata, sel, approved_tuple_count, result_sel);
+		sel.Initialize(result_sel);
+		return approved_tuple_count;
+	}
+	case TableFilterType::OPTIONAL_FILTER: {
+		// we do not have to evaluate optional filters, but doing so removes rows early
+		auto &optional_filter = filter.Cast<OptionalFilter>();
+		return FilterSelection(sel, vector, vdata, *optional_filter.child_filter, scan_count, approved_tuple_count);
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
@@ -20,6 +20,7 @@
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
 
@@ -419,7 +420,13 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::IN_FILTER:
 		return state.current->start + state.current->count;
+	case TableFilterType::OPTIONAL_FILTER: {
+		auto &optional_filter = filter.Cast<OptionalFilter>();
+		return GetFilterScanCount(state, *optional_filter.child_filter);
+	}
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
 	}
@@ -887,9 +894,24 @@ CompressionType ColumnCheckpointInfo::GetCompressionType() {
 
 RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	RowGroupWriteData result;
-	result.states.reserve(columns.size());
-	result.statistics.reserve(columns.size());
+	InitializeWriteData(result);
+	WriteColumnsToDisk(info, 0, GetColumnCount(), result);
+	return result;
+}
 
+void RowGroup::InitializeWriteData(RowGroupWriteData &write_data) {
+	auto &types = GetCollection().GetTypes();
+	write_data.states.resize(columns.size());
+	write_data.statistics.reserve(columns.size());
+	for (idx_t column_idx = 0; column_idx < columns.size(); column_idx++) {
+		write_data.statistics.push_back(BaseStatistics::CreateEmpty(types[column_idx]));
+	}
+}
+
+void RowGroup::WriteColumnsToDisk(RowGroupWriteInfo &info, idx_t column_start, idx_t column_end,
+                                  RowGroupWriteData &write_data) {
+	D_ASSERT(write_data.states.size() == columns.size());
+	D_ASSERT(write_data.statistics.size() == columns.size());
 	// Checkpoint the individual columns of the row group
 	// Here we're iterating over columns. Each column can have multiple segments.
 	// (Some columns will be wider than others, and require different numbers
@@ -898,7 +920,7 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	// Some of these columns are composite (list, struct). The data is written
 	// first sequentially, and the pointers are written later, so that the
 	// pointers all end up densely packed, and thus more cache-friendly.
-	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
+	for (idx_t column_idx = column_start; column_idx < column_end; column_idx++) {
 		auto &column = GetColumn(column_idx);
 		ColumnCheckpointInfo checkpoint_info(info, column_idx);
 		auto checkpoint_state = column.Checkpoint(*this, checkpoint_info);
@@ -907,11 +929,9 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 		auto stats = checkpoint_state->GetStatistics();
 		D_ASSERT(stats);
 
-		result.statistics.push_back(stats->Copy());
-		result.states.push_back(std::move(checkpoint_state));
+		write_data.statistics[column_idx] = stats->Copy();
+		write_data.states[column_idx] = std::move(checkpoint_state);
 	}
-	D_ASSERT(result.states.size() == result.statistics.size());
-	return result;
 }
 
 idx_t RowGroup::GetCommittedRowCount() {
@@ -932,6 +952,12 @@ bool RowGroup::HasUnloadedDeletes() const {
 }
 
 RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
+	auto compression_types = GetCompressionTypes(writer);
+	RowGroupWriteInfo info(writer.GetPartialBlockManager(), compression_types, writer.GetCheckpointType());
+	return WriteToDisk(info);
+}
+
+vector<CompressionType> RowGroup::GetCompressionTypes(RowGroupWriter &writer) {
 	vector<CompressionType> compression_types;
 	compression_types.reserve(columns.size());
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
@@ -943,9 +969,7 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 		}
 		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
 	}
-
-	RowGroupWriteInfo info(writer.GetPartialBlockManager(), compression_types, writer.GetCheckpointType());
-	return WriteToDisk(info);
+	return compression_types;
 }
 
 RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer,
@@ -299,6 +299,29 @@ void RowGroupCollection::Fetch(TransactionData transaction, DataChunk &result, c
 	result.SetCardinality(count);
 }
 
+idx_t RowGroupCollection::SelectVisibleRows(TransactionData transaction, const Vector &row_identifiers, idx_t count,
+                                            SelectionVector &sel) {
+	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto row_id = row_ids[i];
+		RowGroup *row_group;
+		{
+			idx_t segment_index;
+			auto l = row_groups->Lock();
+			if (!row_groups->TryGetSegmentIndex(l, UnsafeNumericCast<idx_t>(row_id), segment_index)) {
+				continue;
+			}
+			row_group = row_groups->GetSegmentByIndex(l, UnsafeNumericCast<int64_t>(segment_index));
+		}
+		if (!row_group->Fetch(transaction, UnsafeNumericCast<idx_t>(row_id) - row_group->start)) {
+			continue;
+		}
+		sel.set_index(result_count++, i);
+	}
+	return result_count;
+}
+
 //===--------------------------------------------------------------------===//
 // Append
 //===--------------------------------------------------------------------===//
@@ -693,20 +716,25 @@ void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_i
 // Checkpoint State
 //===--------------------------------------------------------------------===//
 struct CollectionCheckpointState {
-	CollectionCheckpointState(RowGroupCollection &collection, TableDataWriter &writer,
-	                          vector<SegmentNode<RowGroup>> &segments, TableStatistics &global_stats)
-	    : collection(collection), writer(writer), executor(writer.GetScheduler()), segments(segments),
-	      global_stats(global_stats) {
+	CollectionCheckpointState(RowGroupCollection &collection, TableDataWriter &writer, SegmentLock lock_p,
+	                          vector<SegmentNode<RowGroup>> segments_p, TableStatistics &global_stats)
+	    : collection(collection), writer(writer), executor(writer.GetScheduler()), lock(std::move(lock_p)),
+	      segments(std::move(segments_p)), global_stats(global_stats) {
 		writers.resize(segments.size());
 		write_data.resize(segments.size());
+		compression_types.resize(segments.size());
 	}
 
 	RowGroupCollection &collection;
 	TableDataWriter &writer;
 	TaskExecutor executor;
-	vector<SegmentNode<RowGroup>> &segments;
+	//! The lock on the row groups of the collection, held from the start of the checkpoint until it is finalized
+	SegmentLock lock;
+	vector<SegmentNode<RowGroup>> segments;
 	vector<unique_ptr<RowGroupWriter>> writers;
 	vector<RowGroupWriteData> write_data;
+	//! The compression types of row groups whose columns are checkpointed by multiple tasks
+	vector<vector<CompressionType>> compression_types;
 	TableStatistics &global_stats;
 	mutex write_lock;
 };
@@ -738,6 +766,28 @@ private:
 	idx_t index;
 };
 
+//! Checkpoints a range of the columns of a row group
+class ColumnCheckpointTask : public BaseCheckpointTask {
+public:
+	ColumnCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t index, idx_t column_start,
+	                     idx_t column_end)
+	    : BaseCheckpointTask(checkpoint_state), index(index), column_start(column_start), column_end(column_end) {
+	}
+
+	void ExecuteTask() override {
+		auto &row_group = *checkpoint_state.segments[index].node;
+		auto &row_group_writer = *checkpoint_state.writers[index];
+		RowGroupWriteInfo info(row_group_writer.GetPartialBlockManager(), checkpoint_state.compression_types[index],
+		                       row_group_writer.GetCheckpointType());
+		row_group.WriteColumnsToDisk(info, column_start, column_end, checkpoint_state.write_data[index]);
+	}
+
+private:
+	idx_t index;
+	idx_t column_start;
+	idx_t column_end;
+};
+
 //===--------------------------------------------------------------------===//
 // Vacuum
 //===--------------------------------------------------------------------===//
@@ -961,19 +1011,52 @@ unique_ptr<CheckpointTask> RowGroupCollection::GetCheckpointTask(CollectionCheck
 	return make_uniq<CheckpointTask>(checkpoint_state, segment_idx);
 }
 
+RowGroupCollection::~RowGroupCollection() {
+}
+
+void RowGroupCollection::ScheduleCheckpointTasks(CollectionCheckpointState &checkpoint_state, idx_t segment_idx) {
+	// the number of columns of a row group that are checkpointed by a single task
+	static constexpr const idx_t CHECKPOINT_COLUMNS_PER_TASK = 32;
+
+	auto &row_group = *checkpoint_state.segments[segment_idx].node;
+	auto column_count = types.size();
+	if (column_count <= CHECKPOINT_COLUMNS_PER_TASK) {
+		checkpoint_state.executor.ScheduleTask(GetCheckpointTask(checkpoint_state, segment_idx));
+		return;
+	}
+	// wide row group - checkpoint batches of columns in parallel
+	auto &row_group_writer = checkpoint_state.writers[segment_idx];
+	row_group_writer = checkpoint_state.writer.GetRowGroupWriter(row_group);
+	checkpoint_state.compression_types[segment_idx] = row_group.GetCompressionTypes(*row_group_writer);
+	row_group.InitializeWriteData(checkpoint_state.write_data[segment_idx]);
+	for (idx_t column_start = 0; column_start < column_count; column_start += CHECKPOINT_COLUMNS_PER_TASK) {
+		auto column_end = MinValue<idx_t>(column_start + CHECKPOINT_COLUMNS_PER_TASK, column_count);
+		checkpoint_state.executor.ScheduleTask(
+		    make_uniq<ColumnCheckpointTask>(checkpoint_state, segment_idx, column_start, column_end));
+	}
+}
+
 void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &global_stats) {
+	WriteCheckpointData(writer, global_stats);
+	FinalizeCheckpoint();
+}
+
+void RowGroupCollection::WriteCheckpointData(TableDataWriter &writer, TableStatistics &global_stats) {
+	D_ASSERT(!pending_checkpoint);
 	auto l = row_groups->Lock();
 	auto segments = row_groups->MoveSegments(l);
 
-	CollectionCheckpointState checkpoint_state(*this, writer, segments, global_stats);
+	pending_checkpoint =
+	    make_uniq<CollectionCheckpointState>(*this, writer, std::move(l), std::move(segments), global_stats);
+	auto &checkpoint_state = *pending_checkpoint;
 
 	VacuumState vacuum_state;
-	InitializeVacuumState(checkpoint_state, vacuum_state, segments);
+	InitializeVacuumState(checkpoint_state, vacuum_state, checkpoint_state.segments);
 	// schedule tasks
 	idx_t total_vacuum_tasks = 0;
 	auto &config = DBConfig::GetConfig(writer.GetDatabase());
-	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
-		auto &entry = segments[segment_idx];
+	for (idx_t segment_idx = 0; segment_idx < checkpoint_state.segments.size(); segment_idx++) {
+		auto &entry = checkpoint_state.segments[segment_idx];
 		auto vacuum_tasks = ScheduleVacuumTasks(checkpoint_state, vacuum_state, segment_idx,
 		                                        total_vacuum_tasks < config.options.max_vacuum_tasks);
 		if (vacuum_tasks) {
@@ -985,14 +1068,25 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 			// row group was vacuumed/dropped - skip
 			continue;
 		}
-		// schedule a checkpoint task for this row group
+		// schedule the checkpoint task(s) for this row group
 		entry.node->MoveToCollection(*this, vacuum_state.row_start);
-		auto checkpoint_task = GetCheckpointTask(checkpoint_state, segment_idx);
-		checkpoint_state.executor.ScheduleTask(std::move(checkpoint_task));
+		ScheduleCheckpointTasks(checkpoint_state, segment_idx);
 		vacuum_state.row_start += entry.node->count;
 	}
 	// all tasks have been scheduled - execute tasks until we are done
-	checkpoint_state.executor.WorkOnTasks();
+	try {
+		checkpoint_state.executor.WorkOnTasks();
+	} catch (...) {
+		pending_checkpoint.reset();
+		throw;
+	}
+}
+
+void RowGroupCollection::FinalizeCheckpoint() {
+	D_ASSERT(pending_checkpoint);
+	auto checkpoint_state = std::move(pending_checkpoint);
+	auto &writer = checkpoint_state->writer;
+	auto &segments = checkpoint_state->segments;
 
 	// no errors - finalize the row groups
 	idx_t new_total_rows = 0;
@@ -1003,14 +1097,14 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 			continue;
 		}
 		auto &row_group = *entry.node;
-		auto row_group_writer = std::move(checkpoint_state.writers[segment_idx]);
+		auto row_group_writer = std::move(checkpoint_state->writers[segment_idx]);
 		if (!row_group_writer) {
 			throw InternalException("Missing row group writer for index %llu", segment_idx);
 		}
-		auto pointer =
-		    row_group.Checkpoint(std::move(checkpoint_state.write_data[segment_idx]), *row_group_writer, global_stats);
+		auto pointer = row_group.Checkpoint(std::move(checkpoint_state->write_data[segment_idx]), *row_group_writer,
+		                                    checkpoint_state->global_stats);
 		writer.AddRowGroup(std::move(pointer), std::move(row_group_writer));
-		row_groups->AppendSegment(l, std::move(entry.node));
+		row_groups->AppendSegment(checkpoint_state->lock, std::move(entry.node));
 		new_total_rows += row_group.count;
 	}
 	total_rows = new_total_rows;
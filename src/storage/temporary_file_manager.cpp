@@ -1,6 +1,9 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "duckdb/main/config.hpp"
+
+#include "zstd.h"
 
 namespace duckdb {
 
@@ -8,10 +11,11 @@ namespace duckdb {
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), manager(&manager), block_size(block_size) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr), block_size(0) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -53,12 +57,15 @@ idx_t BlockIndexManager::GetMaxIndex() {
 	return max_index;
 }
 
+idx_t BlockIndexManager::GetIndexCount() {
+	return indexes_in_use.size();
+}
+
 bool BlockIndexManager::HasFreeBlocks() {
 	return !free_indexes.empty();
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMP_FILE_BLOCK_SIZE = DEFAULT_BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +73,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -95,10 +102,11 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 //===--------------------------------------------------------------------===//
 
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
+                                         idx_t index, idx_t buffer_size, TemporaryFileManager &manager)
     : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
+      buffer_size(buffer_size),
       path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      index_manager(manager, buffer_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -120,14 +128,44 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
+	D_ASSERT(!IsCompressed());
 	buffer.Write(*handle, GetPositionInFile(index.block_index));
 }
 
+void TemporaryFileHandle::WriteTemporaryFile(AllocatedData &compressed_buffer, TemporaryFileIndex index) {
+	// We always write the full slot, so that reading a block never runs past the end of the file
+	D_ASSERT(IsCompressed());
+	D_ASSERT(compressed_buffer.GetSize() >= buffer_size);
+	handle->Write(compressed_buffer.get(), buffer_size, GetPositionInFile(index.block_index));
+}
+
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (!IsCompressed()) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle,
+		                                                          GetPositionInFile(block_index),
+		                                                          buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	}
+
+	// Read the compressed slot: the compressed size followed by the compressed contents of the buffer
+	auto compressed_buffer = Allocator::Get(db).Allocate(buffer_size);
+	handle->Read(compressed_buffer.get(), buffer_size, GetPositionInFile(block_index));
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	D_ASSERT(sizeof(idx_t) + compressed_size <= buffer_size);
+
+	// Decompress into a newly constructed (or reused) buffer
+	auto buffer = buffer_manager.ConstructManagedBuffer(buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	auto decompressed_size = duckdb_zstd::ZSTD_decompress(buffer->InternalBuffer(), buffer->AllocSize(),
+	                                                      compressed_buffer.get() + sizeof(idx_t), compressed_size);
+	if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != buffer->AllocSize()) {
+		throw IOException("Failed to decompress block %llu of temporary file \"%s\"", block_index, path);
+	}
+	return buffer;
+}
+
+bool TemporaryFileHandle::IsCompressed() const {
+	return buffer_size != BufferManager::GetBufferManager(db).GetBlockAllocSize();
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -155,6 +193,7 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	info.uncompressed_size = index_manager.GetIndexCount() * BufferManager::GetBufferManager(db).GetBlockAllocSize();
 	return info;
 }
 
@@ -181,7 +220,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	return index * buffer_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -277,17 +316,55 @@ TemporaryFileManager::~TemporaryFileManager() {
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
+idx_t TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer) {
+	auto block_alloc_size = buffer.AllocSize();
+	if (!DBConfig::GetConfig(db).options.temp_file_compression) {
+		return block_alloc_size;
+	}
+
+	// The compressed slot starts with the compressed size, followed by the compressed contents of the buffer
+	auto compressed_bound = duckdb_zstd::ZSTD_compressBound(block_alloc_size);
+	compressed_buffer = Allocator::Get(db).Allocate(sizeof(idx_t) + compressed_bound);
+	auto compressed_size =
+	    duckdb_zstd::ZSTD_compress(compressed_buffer.get() + sizeof(idx_t), compressed_bound, buffer.InternalBuffer(),
+	                               block_alloc_size, COMPRESSION_LEVEL);
+	if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+		// we can always fall back to writing the buffer uncompressed
+		compressed_buffer.Reset();
+		return block_alloc_size;
+	}
+	Store<idx_t>(compressed_size, compressed_buffer.get());
+
+	// Round up to the nearest size class, so that compressed blocks of similar size can share a file
+	auto size_class_size = block_alloc_size / COMPRESSED_SIZE_CLASSES;
+	auto size_class = (sizeof(idx_t) + compressed_size + size_class_size - 1) / size_class_size;
+	auto buffer_size = size_class * size_class_size;
+	if (buffer_size >= block_alloc_size) {
+		// compression does not save any space: write the buffer uncompressed
+		compressed_buffer.Reset();
+		return block_alloc_size;
+	}
+	return buffer_size;
+}
+
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
+	// Compress outside of the lock, this determines the size class of the file we write the buffer to
+	AllocatedData compressed_buffer;
+	auto buffer_size = CompressBuffer(buffer, compressed_buffer);
+
 	{
 		TemporaryManagerLock lock(manager_lock);
 		// first check if we can write to an open existing file
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetBufferSize() != buffer_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -297,7 +374,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, buffer_size, *this);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -308,7 +386,11 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	if (compressed_buffer.IsSet()) {
+		handle->WriteTemporaryFile(compressed_buffer, index);
+	} else {
+		handle->WriteTemporaryFile(buffer, index);
+	}
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
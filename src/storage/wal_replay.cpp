@@ -5,6 +5,7 @@
 #include "duckdb/catalog/catalog_entry/type_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
 #include "duckdb/common/checksum.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/serializer/binary_deserializer.hpp"
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
@@ -17,6 +18,8 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
@@ -25,6 +28,7 @@
 #include "duckdb/planner/expression_binder/index_binder.hpp"
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
@@ -45,6 +49,73 @@ public:
 	idx_t wal_version = 1;
 };
 
+//! An entry of a checksummed WAL (version 2) that has been read from the file
+struct WALReplayEntry {
+	//! The position of the entry in the WAL
+	idx_t offset = 0;
+	idx_t size = 0;
+	uint64_t stored_checksum = 0;
+	unique_ptr<data_t[]> data;
+	//! The type of the entry - set by Decode
+	WALType type = WALType::INVALID;
+	//! The chunk of an insert - set by Decode
+	unique_ptr<DataChunk> chunk;
+	//! The error that occurred while decoding the entry, if any
+	ErrorData error;
+
+	//! Read the next entry from the WAL
+	static WALReplayEntry Read(BufferedFileReader &stream);
+	void VerifyChecksum() const;
+	//! Verify the checksum and read the type of the entry. The chunks of inserts are deserialized as well, all other
+	//! entries are deserialized when they are replayed.
+	void Decode();
+};
+
+WALReplayEntry WALReplayEntry::Read(BufferedFileReader &stream) {
+	WALReplayEntry entry;
+	// read the checksum and size
+	entry.size = stream.Read<uint64_t>();
+	entry.stored_checksum = stream.Read<uint64_t>();
+	entry.offset = stream.CurrentOffset();
+	auto file_size = stream.FileSize();
+
+	if (entry.offset + entry.size > file_size) {
+		throw SerializationException(
+		    "Corrupt WAL file: entry size exceeded remaining data in file at byte position %llu "
+		    "(found entry with size %llu bytes, file size %llu bytes)",
+		    entry.offset, entry.size, file_size);
+	}
+
+	// allocate a buffer and read data into the buffer
+	entry.data = unique_ptr<data_t[]>(new data_t[entry.size]);
+	stream.ReadData(entry.data.get(), entry.size);
+	return entry;
+}
+
+void WALReplayEntry::VerifyChecksum() const {
+	// compute and verify the checksum
+	auto computed_checksum = Checksum(data.get(), size);
+	if (stored_checksum != computed_checksum) {
+		throw IOException("Corrupt WAL file: entry at byte position %llu computed checksum %llu does not match "
+		                  "stored checksum %llu",
+		                  offset, computed_checksum, stored_checksum);
+	}
+}
+
+void WALReplayEntry::Decode() {
+	VerifyChecksum();
+	MemoryStream stream(data.get(), size);
+	BinaryDeserializer deserializer(stream);
+	deserializer.Begin();
+	type = deserializer.ReadProperty<WALType>(100, "wal_type");
+	if (type != WALType::INSERT_TUPLE) {
+		return;
+	}
+	chunk = make_uniq<DataChunk>();
+	deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk->Deserialize(object); });
+	deserializer.End();
+}
+
 class WriteAheadLogDeserializer {
 public:
 	WriteAheadLogDeserializer(ReplayState &state_p, BufferedFileReader &stream_p, bool deserialize_only = false)
@@ -67,31 +138,9 @@ public:
 			throw IOException("Failed to read WAL of version %llu - can only read version 1 and 2",
 			                  state_p.wal_version);
 		}
-		// read the checksum and size
-		auto size = stream.Read<uint64_t>();
-		auto stored_checksum = stream.Read<uint64_t>();
-		auto offset = stream.CurrentOffset();
-		auto file_size = stream.FileSize();
-
-		if (offset + size > file_size) {
-			throw SerializationException(
-			    "Corrupt WAL file: entry size exceeded remaining data in file at byte position %llu "
-			    "(found entry with size %llu bytes, file size %llu bytes)",
-			    offset, size, file_size);
-		}
-
-		// allocate a buffer and read data into the buffer
-		auto buffer = unique_ptr<data_t[]>(new data_t[size]);
-		stream.ReadData(buffer.get(), size);
-
-		// compute and verify the checksum
-		auto computed_checksum = Checksum(buffer.get(), size);
-		if (stored_checksum != computed_checksum) {
-			throw IOException("Corrupt WAL file: entry at byte position %llu computed checksum %llu does not match "
-			                  "stored checksum %llu",
-			                  offset, computed_checksum, stored_checksum);
-		}
-		return WriteAheadLogDeserializer(state_p, std::move(buffer), size, deserialize_only);
+		auto entry = WALReplayEntry::Read(stream);
+		entry.VerifyChecksum();
+		return WriteAheadLogDeserializer(state_p, std::move(entry.data), entry.size, deserialize_only);
 	}
 
 	bool ReplayEntry() {
@@ -101,6 +150,10 @@ public:
 			deserializer.End();
 			return true;
 		}
+		if (deserialize_only && data && IsDataEntry(wal_type)) {
+			// the scan for a checkpoint flag does not need the contents of checksummed data entries - skip them
+			return false;
+		}
 		ReplayEntry(wal_type);
 		deserializer.End();
 		return false;
@@ -111,6 +164,11 @@ public:
 	}
 
 protected:
+	static bool IsDataEntry(WALType wal_type) {
+		return wal_type == WALType::INSERT_TUPLE || wal_type == WALType::DELETE_TUPLE ||
+		       wal_type == WALType::UPDATE_TUPLE;
+	}
+
 	void ReplayEntry(WALType wal_type);
 
 	void ReplayVersion();
@@ -159,6 +217,207 @@ private:
 	bool deserialize_only;
 };
 
+//===--------------------------------------------------------------------===//
+// Batched Replay
+//===--------------------------------------------------------------------===//
+//! The consecutive inserts into a table that are appended together
+struct WALReplayAppend {
+	explicit WALReplayAppend(TableCatalogEntry &table) : table(table) {
+	}
+
+	TableCatalogEntry &table;
+	vector<unique_ptr<DataChunk>> chunks;
+	LocalAppendState append_state;
+};
+
+class WALDecodeTask : public BaseExecutorTask {
+public:
+	WALDecodeTask(TaskExecutor &executor, vector<WALReplayEntry> &entries, idx_t start, idx_t end)
+	    : BaseExecutorTask(executor), entries(entries), start(start), end(end) {
+	}
+
+	void ExecuteTask() override {
+		for (idx_t i = start; i < end; i++) {
+			auto &entry = entries[i];
+			try {
+				entry.Decode();
+			} catch (std::exception &ex) {
+				// errors are reported when the entry is replayed - the entries before it are replayed first
+				entry.error = ErrorData(ex);
+			}
+		}
+	}
+
+private:
+	vector<WALReplayEntry> &entries;
+	idx_t start;
+	idx_t end;
+};
+
+class WALAppendTask : public BaseExecutorTask {
+public:
+	WALAppendTask(TaskExecutor &executor, ClientContext &context, WALReplayAppend &append)
+	    : BaseExecutorTask(executor), context(context), append(append) {
+	}
+
+	void ExecuteTask() override {
+		auto &storage = append.table.GetStorage();
+		for (auto &chunk : append.chunks) {
+			storage.LocalAppend(append.append_state, append.table, context, *chunk, true);
+		}
+	}
+
+private:
+	ClientContext &context;
+	WALReplayAppend &append;
+};
+
+//! Replays the entries of a checksummed WAL in batches. The checksums and the inserted chunks of a batch are decoded
+//! in parallel. Consecutive inserts are appended per table with a single append state, and the inserts into different
+//! tables are appended concurrently. All other entries are replayed one by one and in order.
+class WALBatchReplayer {
+public:
+	//! The amount of WAL data that is read and decoded at once
+	static constexpr idx_t BATCH_SIZE = 32ULL * 1024ULL * 1024ULL;
+	//! The amount of WAL data that is decoded by a single task
+	static constexpr idx_t DECODE_TASK_SIZE = 1024ULL * 1024ULL;
+
+	WALBatchReplayer(ReplayState &state, Connection &con, BufferedFileReader &reader)
+	    : state(state), con(con), reader(reader) {
+	}
+
+	//! Replay the remaining entries of the WAL
+	void Replay();
+
+private:
+	void DecodeBatch(vector<WALReplayEntry> &entries);
+	void ReplayEntry(WALReplayEntry &entry);
+	void AddAppend(TableCatalogEntry &table, unique_ptr<DataChunk> chunk);
+	void FlushAppends();
+
+private:
+	ReplayState &state;
+	Connection &con;
+	BufferedFileReader &reader;
+	//! Whether a transaction is active - a transaction is committed at every flush marker
+	bool transaction_active = true;
+	//! The inserts that have not been appended yet
+	vector<unique_ptr<WALReplayAppend>> appends;
+};
+
+void WALBatchReplayer::Replay() {
+	while (!reader.Finished()) {
+		// read the next batch of entries
+		vector<WALReplayEntry> entries;
+		ErrorData read_error;
+		idx_t batch_size = 0;
+		try {
+			while (!reader.Finished() && batch_size < BATCH_SIZE) {
+				entries.push_back(WALReplayEntry::Read(reader));
+				batch_size += entries.back().size;
+			}
+		} catch (std::exception &ex) {
+			// a torn entry - the entries before it are replayed first
+			read_error = ErrorData(ex);
+		}
+		DecodeBatch(entries);
+		for (auto &entry : entries) {
+			ReplayEntry(entry);
+		}
+		FlushAppends();
+		if (read_error.HasError()) {
+			read_error.Throw();
+		}
+	}
+	if (transaction_active) {
+		throw SerializationException("Corrupt WAL file: the WAL ends with entries that were not flushed");
+	}
+}
+
+void WALBatchReplayer::DecodeBatch(vector<WALReplayEntry> &entries) {
+	TaskExecutor executor(*con.context);
+	idx_t task_start = 0;
+	idx_t task_size = 0;
+	for (idx_t i = 0; i < entries.size(); i++) {
+		task_size += entries[i].size;
+		if (task_size >= DECODE_TASK_SIZE || i + 1 == entries.size()) {
+			executor.ScheduleTask(make_uniq<WALDecodeTask>(executor, entries, task_start, i + 1));
+			task_start = i + 1;
+			task_size = 0;
+		}
+	}
+	executor.WorkOnTasks();
+}
+
+void WALBatchReplayer::ReplayEntry(WALReplayEntry &entry) {
+	if (entry.error.HasError()) {
+		entry.error.Throw();
+	}
+	if (!transaction_active) {
+		con.BeginTransaction();
+		MetaTransaction::Get(*con.context).ModifyDatabase(state.db);
+		transaction_active = true;
+	}
+	if (entry.type == WALType::INSERT_TUPLE) {
+		if (!state.current_table) {
+			throw InternalException("Corrupt WAL: insert without table");
+		}
+		AddAppend(*state.current_table, std::move(entry.chunk));
+		return;
+	}
+	if (entry.type != WALType::USE_TABLE) {
+		// all other entries can depend on the inserts that came before them
+		FlushAppends();
+	}
+	WriteAheadLogDeserializer deserializer(state, std::move(entry.data), entry.size);
+	if (deserializer.ReplayEntry()) {
+		con.Commit();
+		transaction_active = false;
+	}
+}
+
+void WALBatchReplayer::AddAppend(TableCatalogEntry &table, unique_ptr<DataChunk> chunk) {
+	for (auto &append : appends) {
+		if (&append->table == &table) {
+			append->chunks.push_back(std::move(chunk));
+			return;
+		}
+	}
+	auto append = make_uniq<WALReplayAppend>(table);
+	append->chunks.push_back(std::move(chunk));
+	appends.push_back(std::move(append));
+}
+
+void WALBatchReplayer::FlushAppends() {
+	if (appends.empty()) {
+		return;
+	}
+	auto &context = *con.context;
+	// we don't do any constraint verification here
+	vector<unique_ptr<BoundConstraint>> bound_constraints;
+	for (auto &append : appends) {
+		auto &storage = append->table.GetStorage();
+		storage.InitializeLocalAppend(append->append_state, append->table, context, bound_constraints);
+	}
+	if (appends.size() == 1) {
+		auto &append = *appends[0];
+		for (auto &chunk : append.chunks) {
+			append.table.GetStorage().LocalAppend(append.append_state, append.table, context, *chunk, true);
+		}
+	} else {
+		// the inserts into different tables are independent - append them concurrently
+		TaskExecutor executor(context);
+		for (auto &append : appends) {
+			executor.ScheduleTask(make_uniq<WALAppendTask>(executor, context, *append));
+		}
+		executor.WorkOnTasks();
+	}
+	for (auto &append : appends) {
+		append->table.GetStorage().FinalizeLocalAppend(append->append_state);
+	}
+	appends.clear();
+}
+
 //===--------------------------------------------------------------------===//
 // Replay
 //===--------------------------------------------------------------------===//
@@ -213,11 +472,27 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 	// reset the reader - we are going to read the WAL from the beginning again
 	reader.Reset();
 
+	// the WAL is replayed before the worker threads of the database are launched - launch them now so that the
+	// entries can be decoded and appended in parallel
+	auto &scheduler = TaskScheduler::GetScheduler(database.GetDatabase());
+	if (scheduler.NumberOfThreads() < NumericCast<int32_t>(config.options.maximum_threads)) {
+		scheduler.SetThreads(config.options.maximum_threads, config.options.external_threads);
+		scheduler.RelaunchThreads();
+	}
+	Profiler profiler;
+	profiler.Start();
+
 	// replay the WAL
 	// note that everything is wrapped inside a try/catch block here
 	// there can be errors in WAL replay because of a corrupt WAL file
 	try {
 		while (true) {
+			if (state.wal_version >= 2) {
+				// the entries after the version marker are checksummed and can be replayed in batches
+				WALBatchReplayer replayer(state, con, reader);
+				replayer.Replay();
+				break;
+			}
 			// read the current entry
 			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
 			if (deserializer.ReplayEntry()) {
@@ -246,6 +521,8 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		con.Query("ROLLBACK");
 		throw;
 	} // LCOV_EXCL_STOP
+	profiler.End();
+	database.GetStorageManager().RegisterWALReplay(reader.FileSize(), profiler.Elapsed());
 	return false;
 }
 
@@ -14,6 +14,10 @@
 #include "duckdb/storage/table/data_table_info.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/common/checksum.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/main/valid_checker.hpp"
+#include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/storage/table/column_data.hpp"
 
@@ -26,6 +30,15 @@ WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
 }
 
 WriteAheadLog::~WriteAheadLog() {
+	StopAsyncFlusher();
+	if (!writer || synced_position >= written_position || !sync_error.empty()) {
+		return;
+	}
+	// sync the entries of asynchronous commits that have not been synced yet
+	try {
+		writer->handle->Sync();
+	} catch (...) { // NOLINT
+	}
 }
 
 BufferedFileWriter &WriteAheadLog::Initialize() {
@@ -71,6 +84,7 @@ void WriteAheadLog::Truncate(idx_t size) {
 }
 
 void WriteAheadLog::Delete() {
+	StopAsyncFlusher();
 	if (!Initialized()) {
 		return;
 	}
@@ -421,6 +435,129 @@ void WriteAheadLog::Flush() {
 	// flushes all changes made to the WAL to disk
 	writer->Sync();
 	wal_size = writer->GetFileSize();
+
+	// this also makes any commits that are waiting for a sync durable
+	lock_guard<mutex> guard(sync_lock);
+	written_position = MaxValue<idx_t>(written_position, writer->GetTotalWritten());
+	synced_position = MaxValue<idx_t>(synced_position, writer->GetTotalWritten());
+	synced_commits = MaxValue<idx_t>(synced_commits, written_commits);
+}
+
+//===--------------------------------------------------------------------===//
+// Group Commit
+//===--------------------------------------------------------------------===//
+idx_t WriteAheadLog::WriteCommit() {
+	if (!writer) {
+		return 0;
+	}
+
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	// hand the entries to the OS - syncing them to disk happens in SyncCommit, outside of the transaction locks
+	writer->Flush();
+	wal_size = writer->GetFileSize();
+	auto position = writer->GetTotalWritten();
+
+	database.GetStorageManager().RegisterWALCommit();
+	lock_guard<mutex> guard(sync_lock);
+	written_position = MaxValue<idx_t>(written_position, position);
+	written_commits++;
+	return position;
+}
+
+void WriteAheadLog::SyncCommit(idx_t position) {
+	auto &config = DBConfig::Get(database);
+	unique_lock<mutex> guard(sync_lock);
+	if (config.options.wal_sync_mode == WALSyncMode::ASYNC) {
+		// the background flusher syncs the commit within the flush interval
+		if (!async_flusher && !stop_async_flusher) {
+			async_flusher = make_uniq<thread>([this]() { RunAsyncFlusher(); });
+		}
+		return;
+	}
+	while (synced_position < position) {
+		if (!sync_error.empty()) {
+			throw FatalException(sync_error);
+		}
+		if (sync_in_progress) {
+			// another commit is syncing - wait for it and check if its sync included our entries
+			sync_cv.wait(guard);
+			continue;
+		}
+		// become the leader: sync the entries of all commits written so far
+		SyncWrittenEntries(guard);
+	}
+}
+
+void WriteAheadLog::SyncWrittenEntries(unique_lock<mutex> &guard) {
+	D_ASSERT(!sync_in_progress);
+	auto target_position = written_position;
+	auto target_commits = written_commits;
+	sync_in_progress = true;
+	// release the lock while syncing so that other commits can queue up behind this sync
+	// note that the writer cannot be destroyed here: commits waiting for a sync hold the shared checkpoint lock, and
+	// Delete stops the asynchronous flusher before destroying the writer
+	guard.unlock();
+	ErrorData error;
+	auto start = high_resolution_clock::now();
+	try {
+		writer->handle->Sync();
+	} catch (std::exception &ex) {
+		error = ErrorData(ex);
+	}
+	auto seconds = duration<double>(high_resolution_clock::now() - start).count();
+	guard.lock();
+	sync_in_progress = false;
+	if (error.HasError()) {
+		// the commits are already visible in memory, we cannot revert them anymore - invalidate the database
+		sync_error = "Failed to sync the write-ahead log: " + error.RawMessage();
+		ValidChecker::Invalidate(database.GetDatabase(), sync_error);
+	} else if (target_position > synced_position) {
+		auto batch_size = target_commits - synced_commits;
+		synced_position = target_position;
+		synced_commits = target_commits;
+		database.GetStorageManager().RegisterWALSync(batch_size, seconds);
+	}
+	sync_cv.notify_all();
+	if (!sync_error.empty()) {
+		throw FatalException(sync_error);
+	}
+}
+
+void WriteAheadLog::RunAsyncFlusher() {
+	auto &config = DBConfig::Get(database);
+	unique_lock<mutex> guard(sync_lock);
+	while (!stop_async_flusher) {
+		auto interval = milliseconds(config.options.wal_async_flush_interval);
+		flusher_cv.wait_for(guard, interval, [&]() { return stop_async_flusher; });
+		if (stop_async_flusher || !sync_error.empty()) {
+			return;
+		}
+		if (sync_in_progress || synced_position >= written_position) {
+			continue;
+		}
+		try {
+			SyncWrittenEntries(guard);
+		} catch (...) { // NOLINT
+			// the database has been invalidated - there is nobody to report the error to
+			return;
+		}
+	}
+}
+
+void WriteAheadLog::StopAsyncFlusher() {
+	unique_ptr<thread> flusher;
+	{
+		lock_guard<mutex> guard(sync_lock);
+		stop_async_flusher = true;
+		flusher = std::move(async_flusher);
+	}
+	flusher_cv.notify_all();
+	if (flusher) {
+		flusher->join();
+	}
 }
 
 } // namespace duckdb
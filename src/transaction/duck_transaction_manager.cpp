@@ -7,6 +7,7 @@
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
+#include "duckdb/storage/background_checkpointer.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -34,6 +35,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	StopBackgroundCheckpointer();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -104,6 +106,12 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	if (config.options.debug_skip_checkpoint_on_commit) {
 		return CheckpointDecision("checkpointing on commit disabled through configuration");
 	}
+	if (config.options.background_checkpoint) {
+		// the checkpoint is performed by the background checkpointer once this transaction has committed
+		CheckpointDecision decision("checkpoint deferred to the background checkpointer");
+		decision.background_checkpoint = true;
+		return decision;
+	}
 	// try to lock the checkpoint lock
 	lock = transaction.TryGetCheckpointLock();
 	if (!lock) {
@@ -198,6 +206,43 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	storage_manager.CreateCheckpoint(options);
 }
 
+bool DuckTransactionManager::TryBackgroundCheckpoint() {
+	// only checkpoint if there are no write transactions active - we never wait for the lock, as waiting would block
+	// new write transactions from starting
+	auto lock = checkpoint_lock.TryGetExclusiveLock();
+	if (!lock) {
+		return false;
+	}
+	auto &storage_manager = db.GetStorageManager();
+	if (storage_manager.GetWALSize() == 0) {
+		// another checkpoint has already truncated the WAL
+		return true;
+	}
+	CheckpointOptions options;
+	options.action = CheckpointAction::ALWAYS_CHECKPOINT;
+	if (GetLastCommit() > LowestActiveStart()) {
+		// we cannot do a full checkpoint if any transaction needs to read old data
+		options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+	}
+	storage_manager.CreateCheckpoint(options);
+	return true;
+}
+
+void DuckTransactionManager::RequestBackgroundCheckpoint() {
+	lock_guard<mutex> guard(background_checkpointer_lock);
+	if (!background_checkpointer) {
+		background_checkpointer = make_uniq<BackgroundCheckpointer>(*this);
+	}
+	background_checkpointer->RequestCheckpoint();
+}
+
+void DuckTransactionManager::StopBackgroundCheckpointer() {
+	lock_guard<mutex> guard(background_checkpointer_lock);
+	if (background_checkpointer) {
+		background_checkpointer->Stop();
+	}
+}
+
 unique_ptr<StorageLockKey> DuckTransactionManager::SharedCheckpointLock() {
 	return checkpoint_lock.GetSharedLock();
 }
@@ -256,7 +301,7 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	transaction_t commit_id = GetCommitTimestamp();
 	// commit the UndoBuffer of the transaction
 	if (!error.HasError()) {
-		error = transaction.Commit(db, commit_id, std::move(commit_state));
+		error = transaction.Commit(db, commit_id, commit_state.get());
 	}
 	if (error.HasError()) {
 		// commit unsuccessful: rollback the transaction instead
@@ -269,6 +314,19 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 			transaction.catalog_version = ++last_committed_version;
 		}
 	}
+	if (commit_state && !error.HasError()) {
+		// make the WAL entries of the commit durable - this happens without holding the transaction or WAL lock, so
+		// that commits that finish writing to the WAL while we are syncing are included in the next (group) sync
+		// the transaction still holds the shared checkpoint lock, which prevents the WAL from being deleted
+		held_wal_lock.reset();
+		tlock.unlock();
+		try {
+			commit_state->SyncCommit();
+		} catch (std::exception &ex) {
+			error = ErrorData(ex);
+		}
+		tlock.lock();
+	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
 	if (!checkpoint_decision.can_checkpoint && lock) {
@@ -280,6 +338,12 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	// potentially resulting in garbage collection
 	bool store_transaction = undo_properties.has_updates || undo_properties.has_catalog_changes || error.HasError();
 	RemoveTransaction(transaction, store_transaction);
+	if (checkpoint_decision.background_checkpoint) {
+		// hand the checkpoint off to the background checkpointer
+		tlock.unlock();
+		RequestBackgroundCheckpoint();
+		return error;
+	}
 	// now perform a checkpoint if (1) we are able to checkpoint, and (2) the WAL has reached sufficient size to
 	// checkpoint
 	if (checkpoint_decision.can_checkpoint) {
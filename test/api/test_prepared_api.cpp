@@ -496,3 +496,116 @@ TEST_CASE("Test prepared statements with SET", "[api]") {
 	// this works
 	REQUIRE_NO_FAIL(prepare->Execute("NULLS FIRST"));
 }
+
+TEST_CASE("Test sharing prepared plans between connections through the plan cache", "[api]") {
+	duckdb::unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+	Connection con2(db);
+
+	REQUIRE_NO_FAIL(con.Query("SET plan_cache_size=16"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT range i FROM range(100)"));
+
+	// the first prepare plans the query, the plan is returned to the cache when the statement is destroyed
+	auto prepared = con.Prepare("SELECT SUM(i) FROM integers WHERE i < $1");
+	REQUIRE(!prepared->HasError());
+	result = prepared->Execute(10);
+	REQUIRE(CHECK_COLUMN(result, 0, {45}));
+	prepared.reset();
+
+	// another connection takes the plan out of the cache
+	auto prepared2 = con2.Prepare("SELECT SUM(i) FROM integers WHERE i < $1");
+	REQUIRE(!prepared2->HasError());
+	// while the plan is in use it is not handed out to other statements
+	auto prepared3 = con.Prepare("SELECT SUM(i) FROM integers WHERE i < $1");
+	REQUIRE(!prepared3->HasError());
+	result = prepared2->Execute(20);
+	REQUIRE(CHECK_COLUMN(result, 0, {190}));
+	result = prepared3->Execute(5);
+	REQUIRE(CHECK_COLUMN(result, 0, {10}));
+	prepared2.reset();
+	prepared3.reset();
+
+	result = con.Query("SELECT hits, misses, cached_plans FROM duckdb_plan_cache() WHERE query LIKE '%integers%'");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	REQUIRE(CHECK_COLUMN(result, 1, {2}));
+	REQUIRE(CHECK_COLUMN(result, 2, {2}));
+
+	// changing the catalog invalidates the cached plans
+	REQUIRE_NO_FAIL(con.Query("DROP TABLE integers"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT range::VARCHAR i FROM range(3)"));
+	REQUIRE_FAIL(con2.Query("SELECT SUM(i) FROM integers WHERE i < $1", 10));
+	result = con2.Query("SELECT COUNT(*) FROM integers WHERE i < $1", "2");
+	REQUIRE(CHECK_COLUMN(result, 0, {2}));
+	result = con.Query("SELECT hits, cached_plans FROM duckdb_plan_cache() WHERE query ILIKE '%SUM(i)%'");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	REQUIRE(CHECK_COLUMN(result, 1, {0}));
+
+	// disabling the cache clears it
+	REQUIRE_NO_FAIL(con.Query("SET plan_cache_size=0"));
+	result = con.Query("SELECT COUNT(*) FROM duckdb_plan_cache()");
+	REQUIRE(CHECK_COLUMN(result, 0, {0}));
+}
+
+TEST_CASE("Test that the plan cache key includes the settings that change the plan", "[api]") {
+	duckdb::unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+	Connection con2(db);
+
+	REQUIRE_NO_FAIL(con.Query("SET plan_cache_size=16"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE strings(s VARCHAR)"));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO strings VALUES ('a'), ('B'), (NULL)"));
+
+	// the default null order is part of the key
+	auto prepared = con.Prepare("SELECT s FROM strings WHERE s IS NULL OR s <> $1 ORDER BY s");
+	result = prepared->Execute("x");
+	REQUIRE(CHECK_COLUMN(result, 0, {"B", "a", Value()}));
+	prepared.reset();
+	REQUIRE_NO_FAIL(con.Query("SET default_null_order='nulls_first'"));
+	prepared = con2.Prepare("SELECT s FROM strings WHERE s IS NULL OR s <> $1 ORDER BY s");
+	result = prepared->Execute("x");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value(), "B", "a"}));
+	prepared.reset();
+
+	// so is the default order
+	REQUIRE_NO_FAIL(con.Query("SET default_order='desc'"));
+	prepared = con2.Prepare("SELECT s FROM strings WHERE s IS NULL OR s <> $1 ORDER BY s");
+	result = prepared->Execute("x");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value(), "a", "B"}));
+	prepared.reset();
+	REQUIRE_NO_FAIL(con.Query("RESET default_order"));
+	REQUIRE_NO_FAIL(con.Query("RESET default_null_order"));
+
+	// and the default collation
+	prepared = con.Prepare("SELECT COUNT(*) FROM strings WHERE s = $1");
+	result = prepared->Execute("b");
+	REQUIRE(CHECK_COLUMN(result, 0, {0}));
+	prepared.reset();
+	REQUIRE_NO_FAIL(con.Query("SET default_collation='nocase'"));
+	prepared = con2.Prepare("SELECT COUNT(*) FROM strings WHERE s = $1");
+	result = prepared->Execute("b");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	prepared.reset();
+	REQUIRE_NO_FAIL(con.Query("RESET default_collation"));
+
+	// variables are bound as constants, plans using different values are not shared
+	REQUIRE_NO_FAIL(con.Query("SET VARIABLE prefix='a'"));
+	REQUIRE_NO_FAIL(con2.Query("SET VARIABLE prefix='B'"));
+	prepared = con.Prepare("SELECT s FROM strings WHERE s = getvariable('prefix') AND s <> $1");
+	result = prepared->Execute("x");
+	REQUIRE(CHECK_COLUMN(result, 0, {"a"}));
+	prepared.reset();
+	prepared = con2.Prepare("SELECT s FROM strings WHERE s = getvariable('prefix') AND s <> $1");
+	result = prepared->Execute("x");
+	REQUIRE(CHECK_COLUMN(result, 0, {"B"}));
+	prepared.reset();
+
+	// the same statement with the same settings reuses the plan, even if it is formatted differently
+	prepared = con2.Prepare("select s from strings where s = getvariable('prefix')   and s <> $1");
+	result = prepared->Execute("x");
+	REQUIRE(CHECK_COLUMN(result, 0, {"B"}));
+	prepared.reset();
+	result = con.Query("SELECT SUM(hits) FROM duckdb_plan_cache() WHERE query ILIKE '%getvariable%'");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+}
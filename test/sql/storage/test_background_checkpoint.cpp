@@ -0,0 +1,107 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+static bool WaitForCheckpoint(Connection &con) {
+	// the checkpoint runs asynchronously - poll until it has happened
+	for (idx_t i = 0; i < 1000; i++) {
+		auto result = con.Query("SELECT COUNT(*) FROM duckdb_last_checkpoint()");
+		if (!result->HasError() && result->GetValue(0, 0) == Value::BIGINT(1)) {
+			return true;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	return false;
+}
+
+TEST_CASE("Test automatic checkpoints in the background", "[storage]") {
+	duckdb::unique_ptr<QueryResult> result;
+	auto storage_database = TestCreatePath("background_checkpoint_test");
+	auto config = GetTestConfig();
+	config->options.background_checkpoint = true;
+	config->options.checkpoint_wal_size = 1024;
+
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE test(a INTEGER, b VARCHAR)"));
+		// the commit that exceeds the threshold does not checkpoint itself
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO test SELECT i, 'value ' || i FROM range(10000) t(i)"));
+		REQUIRE(WaitForCheckpoint(con));
+
+		result = con.Query("SELECT table_count FROM duckdb_last_checkpoint()");
+		REQUIRE(CHECK_COLUMN(result, 0, {1}));
+		result = con.Query("SELECT COUNT(*), SUM(a) FROM test");
+		REQUIRE(CHECK_COLUMN(result, 0, {10000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {49995000}));
+
+		// commits keep working while checkpoints are running in the background
+		for (idx_t i = 0; i < 50; i++) {
+			REQUIRE_NO_FAIL(con.Query("INSERT INTO test SELECT i, 'value ' || i FROM range(1000) t(i)"));
+			REQUIRE_NO_FAIL(con.Query("UPDATE test SET b = 'updated' WHERE a = " + to_string(i)));
+		}
+		result = con.Query("SELECT COUNT(*) FROM test");
+		REQUIRE(CHECK_COLUMN(result, 0, {60000}));
+		// the database is closed while a checkpoint might still be pending
+	}
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), SUM(a), COUNT(*) FILTER (b = 'updated') FROM test");
+		REQUIRE(CHECK_COLUMN(result, 0, {60000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {49995000 + 50 * 499500}));
+		REQUIRE(CHECK_COLUMN(result, 2, {1325}));
+	}
+	DeleteDatabase(storage_database);
+}
+
+TEST_CASE("Test background checkpoints with concurrent connections", "[storage][.]") {
+	duckdb::unique_ptr<QueryResult> result;
+	auto storage_database = TestCreatePath("background_checkpoint_concurrent_test");
+	auto config = GetTestConfig();
+	config->options.background_checkpoint = true;
+	config->options.checkpoint_wal_size = 4096;
+
+	constexpr idx_t THREAD_COUNT = 4;
+	constexpr idx_t INSERT_COUNT = 200;
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE test(t INTEGER, i INTEGER)"));
+
+		duckdb::vector<std::thread> threads;
+		atomic<bool> success(true);
+		for (idx_t t = 0; t < THREAD_COUNT; t++) {
+			threads.emplace_back([&db, &success, t]() {
+				Connection thread_con(db);
+				for (idx_t i = 0; i < INSERT_COUNT; i++) {
+					auto insert = thread_con.Query("INSERT INTO test VALUES (" + to_string(t) + ", " + to_string(i) +
+					                               ")");
+					if (insert->HasError()) {
+						success = false;
+					}
+				}
+			});
+		}
+		for (auto &thread : threads) {
+			thread.join();
+		}
+		REQUIRE(success);
+		REQUIRE(WaitForCheckpoint(con));
+	}
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), SUM(i) FROM test");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(THREAD_COUNT * INSERT_COUNT)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(THREAD_COUNT * INSERT_COUNT * (INSERT_COUNT - 1) / 2)}));
+	}
+	DeleteDatabase(storage_database);
+}
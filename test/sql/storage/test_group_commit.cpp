@@ -0,0 +1,110 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+static void InsertConcurrently(DuckDB &db, idx_t thread_count, idx_t insert_count) {
+	duckdb::vector<std::thread> threads;
+	atomic<bool> success(true);
+	for (idx_t t = 0; t < thread_count; t++) {
+		threads.emplace_back([&db, &success, t, insert_count]() {
+			Connection con(db);
+			for (idx_t i = 0; i < insert_count; i++) {
+				auto insert = con.Query("INSERT INTO test VALUES (" + to_string(t) + ", " + to_string(i) + ")");
+				if (insert->HasError()) {
+					success = false;
+				}
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	REQUIRE(success);
+}
+
+TEST_CASE("Test group commit of concurrent transactions", "[storage]") {
+	duckdb::unique_ptr<QueryResult> result;
+	auto storage_database = TestCreatePath("group_commit_test");
+	auto config = GetTestConfig();
+	config->options.checkpoint_on_shutdown = false;
+	config->options.checkpoint_wal_size = idx_t(1) << 30;
+
+	constexpr idx_t THREAD_COUNT = 8;
+	constexpr idx_t INSERT_COUNT = 100;
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE test(t INTEGER, i INTEGER)"));
+		InsertConcurrently(db, THREAD_COUNT, INSERT_COUNT);
+
+		// every commit is made durable, but a single sync can cover the commits of several connections
+		result = con.Query("SELECT commit_count, sync_count <= commit_count, synced_commit_count FROM "
+		                   "(SELECT *, CAST(round(avg_batch_size * sync_count) AS BIGINT) AS synced_commit_count "
+		                   "FROM duckdb_wal_statistics())");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(THREAD_COUNT * INSERT_COUNT + 1)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {true}));
+		REQUIRE(CHECK_COLUMN(result, 2, {Value::BIGINT(THREAD_COUNT * INSERT_COUNT + 1)}));
+	}
+	{
+		// the commits are replayed from the WAL
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), SUM(i) FROM test");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(THREAD_COUNT * INSERT_COUNT)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(THREAD_COUNT * INSERT_COUNT * (INSERT_COUNT - 1) / 2)}));
+	}
+	DeleteDatabase(storage_database);
+}
+
+TEST_CASE("Test asynchronous WAL commits", "[storage]") {
+	duckdb::unique_ptr<QueryResult> result;
+	auto storage_database = TestCreatePath("async_commit_test");
+	auto config = GetTestConfig();
+	config->options.checkpoint_on_shutdown = false;
+	config->options.checkpoint_wal_size = idx_t(1) << 30;
+	config->options.wal_sync_mode = WALSyncMode::ASYNC;
+	config->options.wal_async_flush_interval = 5;
+
+	constexpr idx_t THREAD_COUNT = 4;
+	constexpr idx_t INSERT_COUNT = 100;
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE test(t INTEGER, i INTEGER)"));
+		InsertConcurrently(db, THREAD_COUNT, INSERT_COUNT);
+
+		// the background flusher syncs the commits within the flush interval
+		bool synced = false;
+		for (idx_t i = 0; i < 1000 && !synced; i++) {
+			auto statistics =
+			    con.Query("SELECT CAST(round(avg_batch_size * sync_count) AS BIGINT) FROM duckdb_wal_statistics()");
+			REQUIRE_NO_FAIL(*statistics);
+			synced = statistics->GetValue(0, 0) == Value::BIGINT(THREAD_COUNT * INSERT_COUNT + 1);
+			if (!synced) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+		}
+		REQUIRE(synced);
+		result = con.Query("SELECT commit_count, sync_count <= commit_count FROM duckdb_wal_statistics()");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(THREAD_COUNT * INSERT_COUNT + 1)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {true}));
+
+		// commits that have not been synced yet are synced when the database is closed
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO test VALUES (-1, 1000)"));
+	}
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), SUM(i) FROM test");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(THREAD_COUNT * INSERT_COUNT + 1)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(THREAD_COUNT * INSERT_COUNT * (INSERT_COUNT - 1) / 2 + 1000)}));
+	}
+	DeleteDatabase(storage_database);
+}
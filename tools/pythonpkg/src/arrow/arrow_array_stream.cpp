@@ -6,6 +6,8 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 
@@ -300,6 +302,17 @@ py::object GetScalar(Value &constant, const string &timezone_config, const Arrow
 	}
 }
 
+//! Combines two filter expressions with AND. Filters that are not pushed into Arrow are None
+static py::object CombineAnd(py::object left, py::object right) {
+	if (left.is(py::none())) {
+		return right;
+	}
+	if (right.is(py::none())) {
+		return left;
+	}
+	return left.attr("__and__")(right);
+}
+
 py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_ref, const string &timezone_config,
                                     const ArrowType &type) {
 	auto &import_cache = *DuckDBPyConnection::ImportCache();
@@ -353,14 +366,12 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 		return expression;
 	}
 	case TableFilterType::CONJUNCTION_AND: {
-		idx_t i = 0;
 		auto &and_filter = filter->Cast<ConjunctionAndFilter>();
-		auto child_filter = and_filter.child_filters[i++].get();
-		py::object expression = TransformFilterRecursive(child_filter, column_ref, timezone_config, type);
-		while (i < and_filter.child_filters.size()) {
-			child_filter = and_filter.child_filters[i++].get();
-			py::object child_expression = TransformFilterRecursive(child_filter, column_ref, timezone_config, type);
-			expression = expression.attr("__and__")(child_expression);
+		py::object expression = py::none();
+		for (auto &child_filter : and_filter.child_filters) {
+			py::object child_expression =
+			    TransformFilterRecursive(child_filter.get(), column_ref, timezone_config, type);
+			expression = CombineAnd(expression, child_expression);
 		}
 		return expression;
 	}
@@ -378,6 +389,23 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 
 		return child_expr;
 	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter->Cast<InFilter>();
+		auto constant_field = field(py::tuple(py::cast(column_ref)));
+		py::object expression = constant_field.attr("__eq__")(GetScalar(in_filter.values[0], timezone_config, type));
+		for (idx_t i = 1; i < in_filter.values.size(); i++) {
+			auto constant_value = GetScalar(in_filter.values[i], timezone_config, type);
+			expression = expression.attr("__or__")(constant_field.attr("__eq__")(constant_value));
+		}
+		return expression;
+	}
+	//! Bloom filters only remove rows that can not find a join partner, so we can skip them
+	case TableFilterType::BLOOM_FILTER:
+		return py::none();
+	case TableFilterType::OPTIONAL_FILTER: {
+		auto &optional_filter = filter->Cast<OptionalFilter>();
+		return TransformFilterRecursive(optional_filter.child_filter.get(), column_ref, timezone_config, type);
+	}
 	default:
 		throw NotImplementedException("Pushdown Filter Type not supported in Arrow Scans");
 	}
@@ -388,22 +416,17 @@ py::object PythonTableArrowArrayStreamFactory::TransformFilter(TableFilterSet &f
                                                                unordered_map<idx_t, idx_t> filter_to_col,
                                                                const ClientProperties &config,
                                                                const ArrowTableType &arrow_table) {
-	auto filters_map = &filter_collection.filters;
-	auto it = filters_map->begin();
-	D_ASSERT(columns.find(it->first) != columns.end());
-	auto arrow_type = &arrow_table.GetColumns().at(filter_to_col.at(it->first));
-
+	//! If none of the filters can be pushed into Arrow, we return None, i.e., no filter
+	py::object expression = py::none();
 	vector<string> column_ref;
-	column_ref.push_back(columns[it->first]);
-	py::object expression = TransformFilterRecursive(it->second.get(), column_ref, config.time_zone, **arrow_type);
-	while (it != filters_map->end()) {
-		arrow_type = &arrow_table.GetColumns().at(filter_to_col.at(it->first));
+	for (auto &entry : filter_collection.filters) {
+		D_ASSERT(columns.find(entry.first) != columns.end());
+		auto &arrow_type = arrow_table.GetColumns().at(filter_to_col.at(entry.first));
 		column_ref.clear();
-		column_ref.push_back(columns[it->first]);
+		column_ref.push_back(columns[entry.first]);
 		py::object child_expression =
-		    TransformFilterRecursive(it->second.get(), column_ref, config.time_zone, **arrow_type);
-		expression = expression.attr("__and__")(child_expression);
-		it++;
+		    TransformFilterRecursive(entry.second.get(), column_ref, config.time_zone, *arrow_type);
+		expression = CombineAnd(expression, child_expression);
 	}
 	return expression;
 }
@@ -918,3 +918,14 @@ class TestArrowFilterPushdown(object):
         ).fetchall() == [(28, '28')]
 
         pa.unregister_extension_type("duckdb.uhugeint")
+
+    @pytest.mark.parametrize('create_table', [create_pyarrow_table, create_pyarrow_dataset])
+    def test_join_bloom_filter_pushdown(self, duckdb_cursor, create_table):
+        duckdb_cursor.execute("CREATE TABLE probe AS SELECT range i FROM range(100000)")
+        duckdb_cursor.execute("CREATE TABLE build AS SELECT range * 997 i FROM range(100)")
+        arrow_table = create_table(duckdb_cursor.table("probe"))
+
+        # the hash join pushes a Bloom filter over its build keys into the probe side, which Arrow scans skip
+        assert duckdb_cursor.execute(
+            "SELECT COUNT(*), SUM(arrow_table.i) FROM arrow_table JOIN build USING (i)"
+        ).fetchone() == (100, 4935150)